@@ -0,0 +1,110 @@
+/*
+File:		Benchmark.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@11:40
+Purpose:	Declare the benchmarks of the Jabberwock-Test program, which time
+			the optimized paths of the Jabberwock PRNG library against their
+			naive counterparts.
+*/
+
+#ifndef JABBERWOCK_TEST_BENCHMARK_H
+#define JABBERWOCK_TEST_BENCHMARK_H
+
+/*
+Time seeding Jabberwock PRNGs of 3 to 6 levels on one thread against seeding
+their subtrees on every hardware thread, and print the results to the console.
+*/
+extern void benchmarkSeeding();
+/*
+Time hashing runs of the 4-byte chunks hashed while permuting seeds with each
+instruction set the processor supports, and print the results to the console.
+*/
+extern void benchmarkSHA512Many();
+/*
+Time jumping each GLFSR configuration ahead against stepping it byte by byte,
+and print the results to the console.
+*/
+extern void benchmarkGLFSRJump();
+/*
+Time generating from each GLFSR configuration's fixed GLFSR against its GLFSR,
+and print the results to the console.
+*/
+extern void benchmarkFixedGLFSR();
+/*
+Time generating from the tree program of Jabberwock PRNGs of 3 to 6 levels
+against generating from their node trees, and print the throughput and the
+memory each representation walks per byte to the console.
+*/
+extern void benchmarkTreeProgram();
+/*
+Time generating from Jabberwock PRNGs of 3 to 6 levels in bulk against
+generating byte by byte, and print the throughput to the console.
+*/
+extern void benchmarkBulkGenerate();
+/*
+Time generating from Jabberwock PRNGs of 4 to 6 levels in bulk on one thread
+against evaluating their subtrees on every hardware thread, and print the
+throughput to the console.
+*/
+extern void benchmarkParallel();
+/*
+Time seeking through a Jabberwock PRNG's output against generating the skipped
+bytes, and print the results to the console.
+*/
+extern void benchmarkSeek();
+/*
+Time restoring Jabberwock PRNGs of 4 to 6 levels from a snapshot against
+seeding them, and print the times and snapshot sizes to the console.
+*/
+extern void benchmarkSnapshot();
+/*
+Time cloning Jabberwock PRNGs of 4 to 6 levels against seeding them, and print
+the results to the console.
+*/
+extern void benchmarkClone();
+/*
+Time deriving substreams of a Jabberwock PRNG of 5 levels against seeding a
+PRNG per stream, and print the results to the console.
+*/
+extern void benchmarkSubstreams();
+/*
+Time reads of 4KiB from a prefetch buffer against generating them directly,
+and print the latencies and the buffer's counters to the console.
+*/
+extern void benchmarkPrefetchBuffer();
+/*
+Time the class in EmittedGenerator.h against generating from the 4-level
+Jabberwock PRNG it was emitted from, byte by byte and in bulk, and print the
+results to the console.
+*/
+extern void benchmarkCodeGenerator();
+/*
+Print the statistics of Jabberwock PRNGs of 3 to 6 levels, and the time
+generating from them spends in each node type, which is only collected when
+the library is built with JABBERWOCK_PROFILE defined.
+*/
+extern void benchmarkStatistics();
+/*
+Time generating 4MiB from a Jabberwock PRNG of 3 levels into a file through an
+ofstream against an asynchronous writer, with and without syncing each buffer,
+and print the results to the console.
+*/
+extern void benchmarkAsyncWriter();
+/*
+Time drawing dice rolls, characters of a 94-character alphabet and floats from
+a Jabberwock PRNG of 4 levels by reducing 4 bytes per symbol against a
+sampler, and print the rates and bytes per symbol to the console.
+*/
+extern void benchmarkSampler();
+/*
+Time formatting 4M floats drawn ahead into a file through an ofstream against
+a format pipeline over every hardware thread, and print the rates to the
+console.
+*/
+extern void benchmarkFormatPipeline();
+/*
+Run every benchmark and print the results to the console.
+*/
+extern void runBenchmarks();
+
+#endif
\ No newline at end of file
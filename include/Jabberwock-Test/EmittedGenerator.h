@@ -0,0 +1,559 @@
+/*
+File:		EmittedGenerator.h
+Purpose:	A seeded Jabberwock PRNG tree written out as straight-line code by
+			the Jabberwock code generator: 112 GLFSRs under 21 gates in
+			1 subtrees, starting at byte 0 of the output.
+*/
+
+#ifndef JABBERWOCK_GENERATED_EMITTEDGENERATOR_H
+#define JABBERWOCK_GENERATED_EMITTEDGENERATOR_H
+
+#include <cstddef>
+#include <cstdint>
+
+// A Jabberwock PRNG with a fixed seed.
+class EmittedGenerator {
+public:
+	// The offset in the PRNG's output of this generator's first byte.
+	constexpr static uint64_t START_POSITION = 0ULL;
+
+	/*
+	Get a pseudo-random byte of output from the PRNG.
+	Returns: uint8_t - A pseudo-random byte.
+	*/
+	uint8_t generate() {
+		m_position++;
+		uint8_t g0_0 = (uint8_t)(step3(m_state + 195) ^ step8(m_state + 320)
+			^ step3(m_state + 206) ^ step10(m_state + 512) ^ step1(m_state + 0)
+			^ step15(m_state + 724) ^ step9(m_state + 344));
+		uint8_t g0_1 = (uint8_t)(step8(m_state + 328) ^ step3(m_state + 217)
+			^ step10(m_state + 519) ^ step1(m_state + 13)
+			^ step15(m_state + 728) ^ step9(m_state + 352)
+			^ step12(m_state + 582) ^ step13(m_state + 684));
+		uint8_t g0_2 = (uint8_t)(step3(m_state + 228) ^ step10(m_state + 526)
+			^ step1(m_state + 26) ^ step15(m_state + 732)
+			^ step9(m_state + 360));
+		uint8_t g0_3 = (uint8_t)(step8(m_state + 336) ^ step3(m_state + 239)
+			^ step10(m_state + 540) ^ step1(m_state + 65)
+			^ step15(m_state + 752) ^ step9(m_state + 400)
+			^ step12(m_state + 612) ^ step13(m_state + 694));
+		uint8_t g0_4 = (uint8_t)(step3(m_state + 250) ^ step10(m_state + 547)
+			^ step1(m_state + 78) ^ step15(m_state + 756)
+			^ step9(m_state + 408));
+		uint8_t g0_5 = (uint8_t)(step10(m_state + 554) ^ step1(m_state + 91)
+			^ step15(m_state + 760) ^ step9(m_state + 416)
+			^ step12(m_state + 618) ^ step13(m_state + 699)
+			^ step7(m_state + 280) ^ step15(m_state + 764));
+		uint8_t g0_6 = (uint8_t)(step3(m_state + 261) ^ step10(m_state + 561)
+			^ step1(m_state + 117) ^ step15(m_state + 780)
+			^ step9(m_state + 448));
+		uint8_t g0_7 = (uint8_t)(step10(m_state + 575) ^ step1(m_state + 156)
+			^ step15(m_state + 792) ^ step9(m_state + 472)
+			^ step12(m_state + 654) ^ step13(m_state + 709)
+			^ step7(m_state + 296) ^ step15(m_state + 796));
+		uint8_t g0_8 = (uint8_t)(step1(m_state + 169) ^ step15(m_state + 800)
+			^ step9(m_state + 480) ^ step12(m_state + 660)
+			^ step13(m_state + 714) ^ step7(m_state + 304)
+			^ step15(m_state + 804));
+		uint8_t g0_9 = (uint8_t)(step1(m_state + 182) ^ step15(m_state + 812)
+			^ step9(m_state + 496) ^ step12(m_state + 672)
+			^ step13(m_state + 719) ^ step7(m_state + 312)
+			^ step15(m_state + 816));
+		uint8_t g0_12 = (uint8_t)(step10(m_state + 533) & step1(m_state + 39)
+			& step15(m_state + 736) & step9(m_state + 368)
+			& step12(m_state + 588));
+		uint8_t g0_13 = (uint8_t)(step1(m_state + 52) & step15(m_state + 740)
+			& step9(m_state + 376) & step12(m_state + 594));
+		uint8_t g0_14 = (uint8_t)(step1(m_state + 104) & step15(m_state + 768)
+			& step9(m_state + 424) & step12(m_state + 624));
+		uint8_t g0_15 = (uint8_t)(step15(m_state + 808) & step9(m_state + 488)
+			& step12(m_state + 666));
+		uint8_t g0_16 = (uint8_t)(step15(m_state + 820) & step9(m_state + 504)
+			& step12(m_state + 678));
+		uint8_t g0_20 = (uint8_t)(step15(m_state + 744) | step9(m_state + 384)
+			| step12(m_state + 600));
+		uint8_t g0_21 = (uint8_t)(step9(m_state + 392) | step12(m_state + 606)
+			| step13(m_state + 689) | step7(m_state + 272)
+			| step15(m_state + 748));
+		uint8_t g0_22 = (uint8_t)(step15(m_state + 772) | step9(m_state + 432)
+			| step12(m_state + 630));
+		uint8_t g0_23 = (uint8_t)(step9(m_state + 440) | step12(m_state + 636)
+			| step13(m_state + 704) | step7(m_state + 288)
+			| step15(m_state + 776));
+		uint8_t g0_24 = (uint8_t)(step10(m_state + 568) | step1(m_state + 130)
+			| step15(m_state + 784) | step9(m_state + 456)
+			| step12(m_state + 642));
+		uint8_t g0_25 = (uint8_t)(step1(m_state + 143) | step15(m_state + 788)
+			| step9(m_state + 464) | step12(m_state + 648));
+		uint8_t r0_21 = (uint8_t)(g0_16 | g0_9);
+		uint8_t r0_22 = (uint8_t)(g0_15 | g0_8 | g0_7);
+		uint8_t r0_23 = (uint8_t)(g0_25 & g0_24 & g0_6);
+		uint8_t r0_24 = (uint8_t)(g0_23 ^ g0_22 ^ g0_14 ^ g0_5 ^ g0_4 ^ g0_3);
+		uint8_t r0_25 = (uint8_t)(g0_21 ^ g0_20 ^ g0_13 ^ g0_12 ^ g0_2 ^ g0_1
+			^ g0_0);
+		uint8_t r0_26 = (uint8_t)(r0_21 ^ r0_22 ^ r0_23 ^ r0_24 ^ r0_25);
+		return (uint8_t)(r0_26);
+	}
+	/*
+	Fill a buffer with pseudo-random bytes from the PRNG.
+	Parameter: uint8_t* output - The buffer to fill.
+	Parameter: size_t length - The number of bytes to generate.
+	*/
+	void generate(uint8_t* output, size_t length) {
+		for (size_t i = 0; i < length; i++) {
+			output[i] = generate();
+		}
+	}
+	/*
+	Get the PRNG's offset in its output.
+	Returns: uint64_t - The offset of the next byte to be generated.
+	*/
+	uint64_t getPosition() const {
+		return m_position;
+	}
+
+private:
+	/*
+	Advance a 777-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step1(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[12] >> 1);
+		state[12] = ((state[12] << 8) | (state[11] >> 56))
+			& 0x00000000000001ffULL;
+		state[11] = (state[11] << 8) | (state[10] >> 56);
+		state[10] = (state[10] << 8) | (state[9] >> 56);
+		state[9] = (state[9] << 8) | (state[8] >> 56);
+		state[8] = (state[8] << 8) | (state[7] >> 56);
+		state[7] = (state[7] << 8) | (state[6] >> 56);
+		state[6] = (state[6] << 8) | (state[5] >> 56);
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 1)
+			^ ((uint64_t)byte << 10) ^ ((uint64_t)byte << 16);
+		return byte;
+	}
+	/*
+	Advance a 667-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step3(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[10] >> 19);
+		state[10] = ((state[10] << 8) | (state[9] >> 56))
+			& 0x0000000007ffffffULL;
+		state[9] = (state[9] << 8) | (state[8] >> 56);
+		state[8] = (state[8] << 8) | (state[7] >> 56);
+		state[7] = (state[7] << 8) | (state[6] >> 56);
+		state[6] = (state[6] << 8) | (state[5] >> 56);
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 3)
+			^ ((uint64_t)byte << 7) ^ ((uint64_t)byte << 8);
+		return byte;
+	}
+	/*
+	Advance a 512-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step7(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[7] >> 56);
+		state[7] = (state[7] << 8) | (state[6] >> 56);
+		state[6] = (state[6] << 8) | (state[5] >> 56);
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 2)
+			^ ((uint64_t)byte << 5) ^ ((uint64_t)byte << 8);
+		return byte;
+	}
+	/*
+	Advance a 511-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step8(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[7] >> 55);
+		state[7] = ((state[7] << 8) | (state[6] >> 56)) & 0x7fffffffffffffffULL;
+		state[6] = (state[6] << 8) | (state[5] >> 56);
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 2)
+			^ ((uint64_t)byte << 8) ^ ((uint64_t)byte << 10);
+		return byte;
+	}
+	/*
+	Advance a 511-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step9(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[7] >> 55);
+		state[7] = ((state[7] << 8) | (state[6] >> 56)) & 0x7fffffffffffffffULL;
+		state[6] = (state[6] << 8) | (state[5] >> 56);
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 10);
+		return byte;
+	}
+	/*
+	Advance a 444-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step10(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[6] >> 52);
+		state[6] = ((state[6] << 8) | (state[5] >> 56)) & 0x0fffffffffffffffULL;
+		state[5] = (state[5] << 8) | (state[4] >> 56);
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 9)
+			^ ((uint64_t)byte << 12) ^ ((uint64_t)byte << 13);
+		return byte;
+	}
+	/*
+	Advance a 333-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step12(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[5] >> 5);
+		state[5] = ((state[5] << 8) | (state[4] >> 56)) & 0x0000000000001fffULL;
+		state[4] = (state[4] << 8) | (state[3] >> 56);
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 2);
+		return byte;
+	}
+	/*
+	Advance a 303-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step13(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[4] >> 39);
+		state[4] = ((state[4] << 8) | (state[3] >> 56)) & 0x00007fffffffffffULL;
+		state[3] = (state[3] << 8) | (state[2] >> 56);
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 6)
+			^ ((uint64_t)byte << 12) ^ ((uint64_t)byte << 13);
+		return byte;
+	}
+	/*
+	Advance a 222-bit GLFSR by a byte.
+	Parameter: uint64_t* state - The state words of the GLFSR.
+	Returns: uint8_t - The byte shifted out of the GLFSR.
+	*/
+	static uint8_t step15(uint64_t* state) {
+		uint8_t byte = (uint8_t)(state[3] >> 22);
+		state[3] = ((state[3] << 8) | (state[2] >> 56)) & 0x000000003fffffffULL;
+		state[2] = (state[2] << 8) | (state[1] >> 56);
+		state[1] = (state[1] << 8) | (state[0] >> 56);
+		state[0] = (state[0] << 8) ^ (uint64_t)byte ^ ((uint64_t)byte << 2)
+			^ ((uint64_t)byte << 5) ^ ((uint64_t)byte << 8);
+		return byte;
+	}
+
+	// The state words of the GLFSRs.
+	uint64_t m_state[824] = {
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL,
+		0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x00000000000000e9ULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL,
+		0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x00000000000000e9ULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL,
+		0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x00000000000000e9ULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL,
+		0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x00000000000000e9ULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL,
+		0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x00000000000000e9ULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL,
+		0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x00000000000000e9ULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL,
+		0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x00000000000000e9ULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL,
+		0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x00000000000000e9ULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL,
+		0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x00000000000000e9ULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL,
+		0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x00000000000000e9ULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL,
+		0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x00000000000000e9ULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL,
+		0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x00000000000000e9ULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL,
+		0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x00000000000000e9ULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x7d027c980f4478e9ULL,
+		0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL, 0x86fd1e4419380b0eULL,
+		0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL,
+		0xf80b0132f99314c2ULL, 0x00000000000000e9ULL, 0x35aa9a08096bd1beULL,
+		0x8baea9c2e0b23814ULL, 0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL,
+		0x7d027c980f4478e9ULL, 0x34430910bbdaaeb1ULL, 0x4b7a03b701ee8a30ULL,
+		0x86fd1e4419380b0eULL, 0x35aa9a08096bd1beULL, 0x8baea9c2e0b23814ULL,
+		0xc8ab8c834a203933ULL, 0xf80b0132f99314c2ULL, 0x00000000000000e9ULL,
+		0xf805aa25a1f8aaecULL, 0xd7b4240b215fdddaULL, 0x2ddeecd61a412266ULL,
+		0xb54560096cb12024ULL, 0x18497739f11030e0ULL, 0x9f443cd86307caf4ULL,
+		0x4a1bdadb1c4715c7ULL, 0xc19e7cb020173581ULL, 0xf805aa25a1f8aaecULL,
+		0xd7b4240b215fdddaULL, 0x0000000002412266ULL, 0x87eb3ce1f62c1fa7ULL,
+		0xfda4c89b86340dfcULL, 0xdd49778e6ba0bb2fULL, 0xa5a9a33994a5d76dULL,
+		0xa931e1f947a70734ULL, 0x9a8bc6e544c85e82ULL, 0x5f9eb34bf3a5c59fULL,
+		0xc4f964d11c8e5cb5ULL, 0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL,
+		0x0000000003a0bb2fULL, 0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL,
+		0xdd49778e6ba0bb2fULL, 0xa5a9a33994a5d76dULL, 0xa931e1f947a70734ULL,
+		0x9a8bc6e544c85e82ULL, 0x5f9eb34bf3a5c59fULL, 0xc4f964d11c8e5cb5ULL,
+		0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL, 0x0000000003a0bb2fULL,
+		0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL, 0xdd49778e6ba0bb2fULL,
+		0xa5a9a33994a5d76dULL, 0xa931e1f947a70734ULL, 0x9a8bc6e544c85e82ULL,
+		0x5f9eb34bf3a5c59fULL, 0xc4f964d11c8e5cb5ULL, 0x87eb3ce1f62c1fa7ULL,
+		0xfda4c89b86340dfcULL, 0x0000000003a0bb2fULL, 0x87eb3ce1f62c1fa7ULL,
+		0xfda4c89b86340dfcULL, 0xdd49778e6ba0bb2fULL, 0xa5a9a33994a5d76dULL,
+		0xa931e1f947a70734ULL, 0x9a8bc6e544c85e82ULL, 0x5f9eb34bf3a5c59fULL,
+		0xc4f964d11c8e5cb5ULL, 0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL,
+		0x0000000003a0bb2fULL, 0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL,
+		0xdd49778e6ba0bb2fULL, 0xa5a9a33994a5d76dULL, 0xa931e1f947a70734ULL,
+		0x9a8bc6e544c85e82ULL, 0x5f9eb34bf3a5c59fULL, 0xc4f964d11c8e5cb5ULL,
+		0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL, 0x0000000003a0bb2fULL,
+		0x87eb3ce1f62c1fa7ULL, 0xfda4c89b86340dfcULL, 0xdd49778e6ba0bb2fULL,
+		0xa5a9a33994a5d76dULL, 0xa931e1f947a70734ULL, 0x9a8bc6e544c85e82ULL,
+		0x5f9eb34bf3a5c59fULL, 0xc4f964d11c8e5cb5ULL, 0x87eb3ce1f62c1fa7ULL,
+		0xfda4c89b86340dfcULL, 0x0000000003a0bb2fULL, 0x48c7e9f14506a7edULL,
+		0x4dfc44a181870b88ULL, 0xcc960ab9ab03c35dULL, 0x2b050a52e94e80afULL,
+		0x3666626f26ba4b64ULL, 0xd416d3848bd9b6c5ULL, 0xfd90bedb5e307b16ULL,
+		0xea410b68f305d509ULL, 0x48c7e9f14506a7edULL, 0x4dfc44a181870b88ULL,
+		0xcc960ab9ab03c35dULL, 0x2b050a52e94e80afULL, 0x3666626f26ba4b64ULL,
+		0xd416d3848bd9b6c5ULL, 0xfd90bedb5e307b16ULL, 0xea410b68f305d509ULL,
+		0x48c7e9f14506a7edULL, 0x4dfc44a181870b88ULL, 0xcc960ab9ab03c35dULL,
+		0x2b050a52e94e80afULL, 0x3666626f26ba4b64ULL, 0xd416d3848bd9b6c5ULL,
+		0xfd90bedb5e307b16ULL, 0xea410b68f305d509ULL, 0x48c7e9f14506a7edULL,
+		0x4dfc44a181870b88ULL, 0xcc960ab9ab03c35dULL, 0x2b050a52e94e80afULL,
+		0x3666626f26ba4b64ULL, 0xd416d3848bd9b6c5ULL, 0xfd90bedb5e307b16ULL,
+		0xea410b68f305d509ULL, 0x48c7e9f14506a7edULL, 0x4dfc44a181870b88ULL,
+		0xcc960ab9ab03c35dULL, 0x2b050a52e94e80afULL, 0x3666626f26ba4b64ULL,
+		0xd416d3848bd9b6c5ULL, 0xfd90bedb5e307b16ULL, 0xea410b68f305d509ULL,
+		0x48c7e9f14506a7edULL, 0x4dfc44a181870b88ULL, 0xcc960ab9ab03c35dULL,
+		0x2b050a52e94e80afULL, 0x3666626f26ba4b64ULL, 0xd416d3848bd9b6c5ULL,
+		0xfd90bedb5e307b16ULL, 0xea410b68f305d509ULL, 0xa0d8d9a2401c79a9ULL,
+		0x5bb201f0c2655ffdULL, 0xf95bf2590dd6c8fcULL, 0x26d715fc4f08a576ULL,
+		0x4b3fb153a10585ebULL, 0x46cd594f5e3eacedULL, 0xdcd9acce9ede357aULL,
+		0x1f85055790e73713ULL, 0xa0d8d9a2401c79a9ULL, 0x5bb201f0c2655ffdULL,
+		0xf95bf2590dd6c8fcULL, 0x26d715fc4f08a576ULL, 0x4b3fb153a10585ebULL,
+		0x46cd594f5e3eacedULL, 0xdcd9acce9ede357aULL, 0x1f85055790e73713ULL,
+		0xa0d8d9a2401c79a9ULL, 0x5bb201f0c2655ffdULL, 0xf95bf2590dd6c8fcULL,
+		0x26d715fc4f08a576ULL, 0x4b3fb153a10585ebULL, 0x46cd594f5e3eacedULL,
+		0xdcd9acce9ede357aULL, 0x1f85055790e73713ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL,
+		0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL,
+		0x5f35411f1837928bULL, 0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL,
+		0x13343b855fc9fda8ULL, 0xd6784bff805fefceULL, 0xb14f837332e089efULL,
+		0x7c65ff1a872bffc9ULL, 0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL,
+		0x8ada12c34f407864ULL, 0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL,
+		0xd6784bff805fefceULL, 0xb14f837332e089efULL, 0x7c65ff1a872bffc9ULL,
+		0xf3d9911a3693e709ULL, 0x5f35411f1837928bULL, 0x8ada12c34f407864ULL,
+		0x7635c80483c1efc9ULL, 0x13343b855fc9fda8ULL, 0xf47355d92f90f7f5ULL,
+		0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL,
+		0x603360639a50526fULL, 0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL,
+		0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL,
+		0xec98f2d611cb48ceULL, 0x603360639a50526fULL, 0x2532c0cdc457cefcULL,
+		0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL,
+		0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL, 0x603360639a50526fULL,
+		0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL,
+		0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL,
+		0x603360639a50526fULL, 0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL,
+		0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL,
+		0xec98f2d611cb48ceULL, 0x603360639a50526fULL, 0x2532c0cdc457cefcULL,
+		0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL,
+		0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL, 0x603360639a50526fULL,
+		0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL,
+		0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL,
+		0x603360639a50526fULL, 0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL,
+		0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL,
+		0xec98f2d611cb48ceULL, 0x603360639a50526fULL, 0x2532c0cdc457cefcULL,
+		0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL, 0x457a0fcbf71cffd3ULL,
+		0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL, 0x603360639a50526fULL,
+		0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL, 0xf47355d92f90f7f5ULL,
+		0x457a0fcbf71cffd3ULL, 0xd7ae898babe44397ULL, 0xec98f2d611cb48ceULL,
+		0x603360639a50526fULL, 0x2532c0cdc457cefcULL, 0x0a6eb4b2c1a8743bULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x20a168c7d76289f9ULL, 0xae0516883ca22c4aULL, 0x16e0d4788eab6cdaULL,
+		0x772910f8bdd53a5aULL, 0x0f9677653a2cc39dULL, 0x0000000000000865ULL,
+		0x48ae807ab95245ffULL, 0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL,
+		0x2449dda8575db425ULL, 0x000011e07551373dULL, 0x48ae807ab95245ffULL,
+		0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL, 0x2449dda8575db425ULL,
+		0x000011e07551373dULL, 0x48ae807ab95245ffULL, 0x5e53c1618b6503baULL,
+		0xcd5284a40046fb5aULL, 0x2449dda8575db425ULL, 0x000011e07551373dULL,
+		0x48ae807ab95245ffULL, 0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL,
+		0x2449dda8575db425ULL, 0x000011e07551373dULL, 0x48ae807ab95245ffULL,
+		0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL, 0x2449dda8575db425ULL,
+		0x000011e07551373dULL, 0x48ae807ab95245ffULL, 0x5e53c1618b6503baULL,
+		0xcd5284a40046fb5aULL, 0x2449dda8575db425ULL, 0x000011e07551373dULL,
+		0x48ae807ab95245ffULL, 0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL,
+		0x2449dda8575db425ULL, 0x000011e07551373dULL, 0x48ae807ab95245ffULL,
+		0x5e53c1618b6503baULL, 0xcd5284a40046fb5aULL, 0x2449dda8575db425ULL,
+		0x000011e07551373dULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x7c2fa459c936755bULL, 0xeb446b6673211dc7ULL,
+		0x4e4df7129752ff3bULL, 0x000000002be65dfcULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x7c2fa459c936755bULL,
+		0xeb446b6673211dc7ULL, 0x4e4df7129752ff3bULL, 0x000000002be65dfcULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x7c2fa459c936755bULL,
+		0xeb446b6673211dc7ULL, 0x4e4df7129752ff3bULL, 0x000000002be65dfcULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL,
+		0x000000001394875fULL, 0x7c2fa459c936755bULL, 0xeb446b6673211dc7ULL,
+		0x4e4df7129752ff3bULL, 0x000000002be65dfcULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x7c2fa459c936755bULL, 0xeb446b6673211dc7ULL, 0x4e4df7129752ff3bULL,
+		0x000000002be65dfcULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL, 0x2404e3ed18e48214ULL,
+		0x353a7ec9ffedd755ULL, 0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+		0x7c2fa459c936755bULL, 0xeb446b6673211dc7ULL, 0x4e4df7129752ff3bULL,
+		0x000000002be65dfcULL, 0x2404e3ed18e48214ULL, 0x353a7ec9ffedd755ULL,
+		0xb0bfe7b693f7e7cbULL, 0x000000001394875fULL,
+	};
+	// The offset of the next byte to be generated.
+	uint64_t m_position = START_POSITION;
+};
+
+#endif
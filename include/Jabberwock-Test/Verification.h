@@ -0,0 +1,166 @@
+/*
+File:		Verification.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@10:05
+Purpose:	Declare the verification checks of the Jabberwock-Test program,
+			which compare the optimized paths of the Jabberwock PRNG library
+			against their reference implementations.
+*/
+
+#ifndef JABBERWOCK_TEST_VERIFICATION_H
+#define JABBERWOCK_TEST_VERIFICATION_H
+
+/*
+Check that the raw SHA-512 digest matches the hex digest of the SHA library for
+inputs spanning one to three message blocks.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySHA512Raw();
+/*
+Check that the multi-buffer SHA-512 digests match the hex digests of the SHA
+library for runs of messages of several lengths, for every instruction set the
+processor supports.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySHA512Many();
+/*
+Check that permuting strings in place matches the original substring-based
+permutation along a chain of permutations.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyPermuteString();
+/*
+Check that the byte-wide GLFSR step matches the bit-serial GLFSR step for every
+GLFSR configuration.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyGLFSRKernel();
+/*
+Check that jumping a GLFSR ahead matches stepping it for every GLFSR
+configuration.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyGLFSRJump();
+/*
+Check that the fixed GLFSR of every GLFSR configuration has the
+configuration's length and feedback table and matches the GLFSR's output and
+state, stepping by bytes and by bits.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyFixedGLFSR();
+/*
+Check that trees whose GLFSRs are stepped by a leaf bank match unbanked trees
+for every instruction set the processor supports.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyLeafBank();
+/*
+Check that trees reseeded in a reset node arena generate the same output as
+fresh trees without growing the arena.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyNodeArena();
+/*
+Check that the tree program of a Jabberwock PRNG generates the same output as
+its unbanked tree.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyTreeProgram();
+/*
+Check that generating a Jabberwock PRNG's output in bulk matches generating it
+byte by byte, across block boundaries.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyBulkGenerate();
+/*
+Check that evaluating a Jabberwock PRNG's subtrees in parallel generates the
+same output as evaluating its tree on one thread.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyParallel();
+/*
+Check that trees whose sibling subtrees are seeded concurrently on a thread pool
+match trees seeded on one thread.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyParallelSeeding();
+/*
+Check that discarding and seeking through a Jabberwock PRNG's output match
+generating it.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySeek();
+/*
+Check that a Jabberwock PRNG loaded from a snapshot continues the output of the
+PRNG it was saved from, and that damaged snapshots are refused.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySnapshot();
+/*
+Check that a clone of a Jabberwock PRNG generates the same output as the PRNG
+it was cloned from, independently of it.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyClone();
+/*
+Check that the substreams of a Jabberwock PRNG start at their offsets in its
+output and generate the same output when derived on separate threads.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySubstreams();
+/*
+Check that reads from a prefetch buffer, by one consumer and by several at
+once, return the output of the PRNG it was started from at the offsets they
+report.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyPrefetchBuffer();
+/*
+Check that the class which the code generator wrote to EmittedGenerator.h
+generates the same output as the Jabberwock PRNG it was emitted from, and that
+emitting source is repeatable and refuses bad input.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyCodeGenerator();
+/*
+Check that the statistics of seeded Jabberwock PRNGs, with one subtree and
+with several, count the same nodes, depth and GLFSR state as the unbanked
+tree, and that the profile can be reset.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyStatistics();
+/*
+Check that an asynchronous writer writes the same bytes to its file whether
+they are submitted in place or copied in, under every sync policy, and that it
+refuses files which cannot be opened.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyAsyncWriter();
+/*
+Check that a sampler's draws match the output of its PRNG for power of 2
+bounds, alphabets and floats, stay in their ranges, and spread evenly below
+small bounds.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifySampler();
+/*
+Check that a format pipeline, with and without workers, writes the same text
+as formatting its symbols one by one through an ostream, across its chunk and
+batch boundaries.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyFormatPipeline();
+/*
+Check that packed ranges reject bounds outside their element type, that .npy
+headers are aligned and describe their array, and that packed elements are the
+sampler's draws stored little-endian.
+Returns: bool - Whether the check passed.
+*/
+extern bool verifyPackedFormat();
+/*
+Run every verification check and print the results to the console.
+Returns: bool - Whether every check passed.
+*/
+extern bool runVerification();
+
+#endif
\ No newline at end of file
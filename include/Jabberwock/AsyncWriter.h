@@ -0,0 +1,174 @@
+/*
+File:		AsyncWriter.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@19:10
+Purpose:	Declare the asynchronous writer, a pair of buffers which one thread
+			fills while a dedicated I/O thread writes the other to a file.
+*/
+
+#ifndef JABBERWOCK_ASYNCWRITER_H
+#define JABBERWOCK_ASYNCWRITER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The default number of bytes in each buffer of an asynchronous writer.
+const static size_t ASYNC_WRITER_BUFFER_LENGTH = 1 << 20;
+
+// When an asynchronous writer forces its written bytes to the storage device.
+enum class SyncPolicy : uint8_t {
+	// Leave the bytes to the operating system.
+	NEVER,
+	// Force every byte to the device when the writer is closed.
+	ON_CLOSE,
+	// Force each buffer to the device as soon as it is written.
+	EVERY_BUFFER,
+};
+
+/*
+A double-buffered file writer which overlaps producing output with writing it.
+The producer fills one buffer while a dedicated I/O thread writes the other;
+submitting a full buffer hands it to the I/O thread and swaps the two, so the
+producer only waits when it fills a buffer faster than the last one could be
+written.
+*/
+class AsyncWriter {
+public:
+	/*
+	Close this asynchronous writer.
+	*/
+	~AsyncWriter();
+	/*
+	Open a file to write to, replacing any file already open.
+	Parameter: const std::string& fileName - The name of the file, which is
+	created or truncated and written in binary.
+	Parameter: size_t bufferLength - The number of bytes in each buffer.
+	Parameter: SyncPolicy syncPolicy - When to force written bytes to the
+	storage device.
+	Returns: bool - Whether the file was opened.
+	*/
+	bool open(const std::string&, size_t, SyncPolicy);
+	/*
+	Write to an already open file, such as the standard output, replacing any
+	file already open. The file is flushed but not closed when the writer is.
+	Parameter: std::FILE* file - The file to write to, opened in binary.
+	Parameter: size_t bufferLength - The number of bytes in each buffer.
+	Parameter: SyncPolicy syncPolicy - When to force written bytes to the
+	storage device.
+	Returns: bool - Whether the I/O thread was started.
+	*/
+	bool open(std::FILE*, size_t, SyncPolicy);
+	/*
+	Get the buffer which the producer fills; it is only valid until the next
+	submit or write.
+	Returns: uint8_t* - The buffer, of getBufferLength() bytes.
+	*/
+	uint8_t* getBuffer();
+	/*
+	Get the number of bytes in each buffer of this asynchronous writer.
+	Returns: size_t - The length of the buffers.
+	*/
+	size_t getBufferLength() const;
+	/*
+	Hand the start of the filled buffer to the I/O thread, after waiting for it
+	to finish writing the previous buffer, and swap the buffers.
+	Parameter: size_t length - The number of bytes filled, at most the buffer
+	length.
+	Returns: bool - Whether every earlier buffer was written.
+	*/
+	bool submit(size_t);
+	/*
+	Copy bytes into the filled buffer after any bytes copied since the last
+	submit, submitting it each time it fills.
+	Parameter: const void* data - The bytes to copy.
+	Parameter: size_t length - The number of bytes to copy.
+	Returns: bool - Whether every earlier buffer was written.
+	*/
+	bool write(const void*, size_t);
+	/*
+	Submit any bytes copied by write, wait for every buffer to be written,
+	apply the sync policy and close the file.
+	Returns: bool - Whether every byte was written and synced.
+	*/
+	bool close();
+	/*
+	Get the number of bytes this asynchronous writer has written to its file.
+	Returns: uint64_t - The number of bytes the I/O thread has finished writing.
+	*/
+	uint64_t getWrittenBytes();
+	/*
+	Get the error of the first write, sync or close of the file which failed.
+	Returns: int - The errno of the failure, or 0 if none has failed.
+	*/
+	int getError();
+
+private:
+	/*
+	Start the I/O thread over a file.
+	Parameter: std::FILE* file - The file to write to.
+	Parameter: bool ownsFile - Whether to close the file with the writer.
+	Parameter: size_t bufferLength - The number of bytes in each buffer.
+	Parameter: SyncPolicy syncPolicy - When to force written bytes to the
+	storage device.
+	*/
+	void start(std::FILE*, bool, size_t, SyncPolicy);
+	/*
+	Write submitted buffers to the file until the writer is closed.
+	*/
+	void flush();
+	/*
+	Mark the writer failed, keeping the error of the first failure. Called
+	with the mutex held, or once the I/O thread has exited.
+	Parameter: int error - The errno of the failure.
+	*/
+	void recordError(int);
+	/*
+	Force the bytes written to the file to its storage device, or only flush
+	them if the file is not a regular file.
+	Returns: bool - Whether the bytes were forced.
+	*/
+	bool sync();
+
+	// The file written to.
+	std::FILE* m_file = nullptr;
+	// Whether the file was opened by the writer, which closes it.
+	bool m_ownsFile = false;
+	// When to force written bytes to the storage device.
+	SyncPolicy m_syncPolicy = SyncPolicy::NEVER;
+	// Whether the file is a regular file, which can be forced to its storage
+	// device; pipes and terminals are only flushed.
+	bool m_syncable = false;
+	// The two buffers.
+	std::vector<uint8_t> m_buffers[2];
+	// The index of the buffer which the producer fills.
+	size_t m_fillBuffer = 0;
+	// The number of bytes copied into the filled buffer by write.
+	size_t m_fillLength = 0;
+	// The I/O thread.
+	std::thread m_thread;
+	// The lock over the state shared with the I/O thread.
+	std::mutex m_mutex;
+	// Signalled when a buffer is submitted or the writer is closed.
+	std::condition_variable m_wake;
+	// Signalled when the I/O thread finishes writing a buffer.
+	std::condition_variable m_done;
+	// The number of bytes of the submitted buffer, or 0 if none is waiting to
+	// be written.
+	size_t m_pendingLength = 0;
+	// Whether the I/O thread should exit once the pending buffer is written.
+	bool m_stopping = false;
+	// Whether a write or sync of the file has failed.
+	bool m_failed = false;
+	// The errno of the first failed write, sync or close, or 0.
+	int m_error = 0;
+	// The number of bytes written to the file.
+	uint64_t m_writtenBytes = 0;
+};
+
+#endif
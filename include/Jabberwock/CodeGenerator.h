@@ -0,0 +1,85 @@
+/*
+File:		CodeGenerator.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@18:25
+Purpose:	Declare the code generator, which writes a seeded Jabberwock PRNG
+			tree out as a standalone C++ header of straight-line code.
+*/
+
+#ifndef JABBERWOCK_CODEGENERATOR_H
+#define JABBERWOCK_CODEGENERATOR_H
+
+#include "LeafBank.h"
+#include "TreeProgram.h"
+
+#include <ostream>
+#include <string>
+
+/*
+A generator of C++ source for a seeded Jabberwock PRNG tree. The source is a
+header declaring one class with no dependencies on the library: its GLFSR
+states are a literal array, each GLFSR configuration in use gets its own step
+function with its shifts, masks and taps written in as constants, and each
+gate and instruction of the tree becomes one line of generate(), so the tree
+is evaluated without any loops, tables or virtual calls.
+*/
+class CodeGenerator {
+public:
+	/*
+	Add a compiled subtree of the tree, whose output is XORed into the output
+	of the generated class. The states of its GLFSRs are copied as they are.
+	Parameter: const LeafBank& bank - The finalized leaf bank of the subtree.
+	Parameter: const TreeProgram& program - The compiled tree program of the
+	subtree.
+	Returns: bool - Whether the subtree was added; the program must be compiled.
+	*/
+	bool addSubtree(const LeafBank&, const TreeProgram&);
+	/*
+	Write the header of the generated class.
+	Parameter: std::ostream& output - The stream to write to.
+	Parameter: const std::string& className - The name of the generated class,
+	a C++ identifier.
+	Parameter: uint64_t position - The offset in the PRNG's output of the
+	generated class's first byte.
+	Returns: bool - Whether the header was written; at least one subtree must
+	have been added and the class name must be an identifier.
+	*/
+	bool write(std::ostream&, const std::string&, uint64_t) const;
+	/*
+	Free this code generator's memory.
+	*/
+	void clear();
+
+private:
+	// A GLFSR of the tree.
+	struct Leaf {
+		// The index of the GLFSR's entry in GLFSR_CONFIGS.
+		size_t config;
+		// The offset of the GLFSR's state in the generated state array.
+		size_t offset;
+	};
+	// A gate over GLFSRs of the tree.
+	struct Gate {
+		// The type of the gate.
+		NodeType type = NodeType::XOR;
+		// The indices of the gate's GLFSRs, in their order in the gate.
+		std::vector<size_t> leaves;
+	};
+	// A subtree of the tree.
+	struct Subtree {
+		// The gates of the subtree, by their index in the leaf bank's outputs;
+		// padding outputs have no GLFSRs.
+		std::vector<Gate> gates;
+		// The instructions of the subtree's tree program.
+		std::vector<TreeProgram::Instruction> instructions;
+	};
+
+	// The GLFSRs of every subtree.
+	std::vector<Leaf> m_leaves;
+	// The state words of every GLFSR, in the order of m_leaves.
+	std::vector<uint64_t> m_state;
+	// The subtrees of the tree.
+	std::vector<Subtree> m_subtrees;
+};
+
+#endif
@@ -0,0 +1,160 @@
+/*
+File:		FormatPipeline.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@20:20
+Purpose:	Declare the format pipeline, which draws symbols, formats them as
+			text across a thread pool and writes the text in order.
+*/
+
+#ifndef JABBERWOCK_FORMATPIPELINE_H
+#define JABBERWOCK_FORMATPIPELINE_H
+
+#include "AsyncWriter.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// The number of symbols each task of a format pipeline formats.
+const static size_t FORMAT_CHUNK_LENGTH = 1 << 12;
+
+/*
+A three-stage pipeline for text output. A producer thread draws the next batch
+of symbols, which must happen in order since draws may reject bytes, while the
+workers of a thread pool format the current batch in chunks into buffers of
+their own, and the chunks are then written to an asynchronous writer in order.
+Each symbol is formatted alone, so the text is the same as formatting the
+symbols one by one.
+*/
+class FormatPipeline {
+public:
+	/*
+	Start this format pipeline's workers, replacing any running workers.
+	Parameter: size_t workerCount - The number of worker threads besides the
+	calling thread.
+	*/
+	void start(size_t);
+	/*
+	Draw, format and write symbols through this format pipeline.
+	Template: typename T - The type of the symbols.
+	Template: typename Draw - The type of the draw function.
+	Template: typename Format - The type of the format function.
+	Parameter: uint64_t symbolCount - The number of symbols to write.
+	Parameter: size_t maximumLength - The most characters a symbol formats to.
+	Parameter: AsyncWriter& writer - The open writer to write the text to.
+	Parameter: Draw draw - Called as T() to draw each symbol in order, on a
+	thread of its own.
+	Parameter: Format format - Called as char*(char* output, T symbol) to write
+	a symbol's text and return the end of it, on any thread.
+	Parameter: const std::function<void(uint64_t)>& progress - Called with the
+	number of symbols written after each batch, if set.
+	Returns: bool - Whether every symbol was written.
+	*/
+	template <typename T, typename Draw, typename Format>
+	bool run(uint64_t symbolCount, size_t maximumLength, AsyncWriter& writer,
+		Draw draw, Format format,
+		const std::function<void(uint64_t)>& progress) {
+		size_t chunkCount = m_pool.getWorkerCount() + 1;
+		size_t batchLength = chunkCount * FORMAT_CHUNK_LENGTH;
+		m_chunks.resize(chunkCount);
+		for (std::vector<char>& chunk : m_chunks) {
+			chunk.resize(FORMAT_CHUNK_LENGTH * maximumLength);
+		}
+		m_chunkLengths.assign(chunkCount, 0);
+		std::vector<T> batches[2] = {
+			std::vector<T>(batchLength),
+			std::vector<T>(batchLength),
+		};
+		size_t current = 0;
+		size_t length = (size_t)std::min((uint64_t)batchLength, symbolCount);
+		for (size_t i = 0; i < length; i++) {
+			batches[current][i] = draw();
+		}
+		// The producer lives for the whole run, and is handed each batch to
+		// draw, or told to stop, under the mutex.
+		std::mutex mutex;
+		std::condition_variable wake;
+		std::condition_variable done;
+		T* next = nullptr;
+		size_t nextLength = 0;
+		bool stopping = false;
+		std::thread producer([&]() {
+			std::unique_lock<std::mutex> lock(mutex);
+			while (true) {
+				wake.wait(lock, [&]() { return nextLength != 0 || stopping; });
+				if (nextLength == 0) {
+					return;
+				}
+				lock.unlock();
+				for (size_t i = 0; i < nextLength; i++) {
+					next[i] = draw();
+				}
+				lock.lock();
+				nextLength = 0;
+				done.notify_one();
+			}
+		});
+		bool success = true;
+		for (uint64_t offset = 0; offset < symbolCount && success;) {
+			uint64_t nextOffset = offset + length;
+			size_t drawLength = (size_t)std::min((uint64_t)batchLength,
+				symbolCount - nextOffset);
+			if (drawLength != 0) {
+				std::lock_guard<std::mutex> lock(mutex);
+				next = batches[current ^ 1].data();
+				nextLength = drawLength;
+				wake.notify_one();
+			}
+			const T* batch = batches[current].data();
+			m_pool.run(chunkCount, [&, batch, length](size_t c) {
+				size_t first = std::min(c * FORMAT_CHUNK_LENGTH, length);
+				size_t last = std::min(first + FORMAT_CHUNK_LENGTH, length);
+				char* output = m_chunks[c].data();
+				for (size_t i = first; i < last; i++) {
+					output = format(output, batch[i]);
+				}
+				m_chunkLengths[c] = (size_t)(output - m_chunks[c].data());
+			});
+			for (size_t c = 0; c < chunkCount; c++) {
+				success &= writer.write(m_chunks[c].data(), m_chunkLengths[c]);
+			}
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				done.wait(lock, [&]() { return nextLength == 0; });
+			}
+			offset = nextOffset;
+			length = drawLength;
+			current ^= 1;
+			if (progress) {
+				progress(offset);
+			}
+		}
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_one();
+		producer.join();
+		return success;
+	}
+	/*
+	Stop and join this format pipeline's workers, and free its buffers.
+	*/
+	void stop();
+
+private:
+	// The workers which format the chunks of each batch.
+	ThreadPool m_pool;
+	// The text buffer of each chunk of a batch.
+	std::vector<std::vector<char>> m_chunks;
+	// The number of characters formatted into each chunk's buffer.
+	std::vector<size_t> m_chunkLengths;
+};
+
+#endif
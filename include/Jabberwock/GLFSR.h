@@ -0,0 +1,328 @@
+/*
+File:		GLFSR.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@09:12
+Purpose:	Declare the word-packed Galois linear feedback shift register engine
+			used by the GLFSR nodes of the Jabberwock PRNG tree.
+*/
+
+#ifndef JABBERWOCK_GLFSR_H
+#define JABBERWOCK_GLFSR_H
+
+#include "Hash.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <variant>
+#include <vector>
+
+// The set of 16 GLFSR configurations; each entry is a register length followed
+// by the tap positions of the register, counted from its output end.
+const static std::vector<std::vector<size_t>> GLFSR_CONFIGS = {
+	{ 1024, 1024, 1015, 1002, 1001, },
+	{ 777, 777, 776, 767, 761, },
+	{ 777, 777, 748, },
+	{ 667, 667, 664, 660, 659, },
+	{ 666, 666, 664, 659, 656, },
+	{ 665, 665, 661, 659, 654, },
+	{ 665, 665, 632, },
+	{ 512, 512, 510, 507, 504, },
+	{ 511, 511, 509, 503, 501, },
+	{ 511, 511, 501, },
+	{ 444, 444, 435, 432, 431, },
+	{ 333, 333, 331, 329, 325, },
+	{ 333, 333, 331, },
+	{ 303, 303, 297, 291, 290, },
+	{ 256, 256, 254, 251, 246, },
+	{ 222, 222, 220, 217, 214, },
+};
+
+/*
+Get the byte-wide feedback table of a GLFSR configuration, which maps the 8
+output bits of a byte-wide step to the feedback they leave in the lowest state
+word; the table of the configuration's fixed GLFSR, computed at compile time.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+Returns: const uint64_t* - The configuration's 256-entry feedback table, or
+nullptr if the configuration's taps do not allow a byte-wide step.
+*/
+extern const uint64_t* GLFSRFeedbackTable(size_t);
+
+/*
+Compute the polynomial which advances a GLFSR by a number of steps. A GLFSR's
+state words are the coefficients of a polynomial over GF(2) and one step
+multiplies it by x modulo the register's characteristic polynomial, so the
+jump polynomial is x^steps modulo the characteristic polynomial, computed by
+repeated squaring.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+Parameter: uint64_t steps - The number of steps to advance by.
+Returns: std::vector<uint64_t> - The coefficient words of the jump polynomial,
+least significant word first.
+*/
+extern std::vector<uint64_t> GLFSRJumpPolynomial(size_t, uint64_t);
+/*
+Advance the state words of a GLFSR by multiplying them by a jump polynomial of
+the GLFSR's configuration.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+Parameter: uint64_t* state - The configuration's number of state words to
+advance.
+Parameter: const std::vector<uint64_t>& jumpPolynomial - The jump polynomial
+from GLFSRJumpPolynomial.
+*/
+extern void GLFSRApplyJump(size_t, uint64_t*, const std::vector<uint64_t>&);
+
+/*
+Fill the state words of a GLFSR from a digest. Bit i of the register is digest
+bit i % 512, so each state word is a digest word with the bits of each of its
+bytes reversed.
+Parameter: const SHA512Digest& stateDigest - The digest to fill the state from.
+Parameter: uint64_t* state - The state words to fill.
+Parameter: size_t wordCount - The number of state words.
+Parameter: uint64_t topMask - The mask of the valid bits in the top word.
+*/
+extern void GLFSRFillState(const SHA512Digest&, uint64_t*, size_t, uint64_t);
+
+/*
+A GLFSR whose configuration is fixed at compile time, with the same register
+layout as the GLFSR class. Its word count, top word mask, tap masks and
+byte-wide feedback table are computed at compile time and its state is a
+fixed-size array, so every loop over the state words unrolls and the feedback
+table is a constant shared by every instantiation of the configuration.
+Template: size_t Length - The number of bits in the register.
+Template: size_t... Taps - The tap positions of the register, counted from its
+output end.
+*/
+template <size_t Length, size_t... Taps>
+class FixedGLFSR {
+public:
+	// The number of bits in the register.
+	constexpr static size_t LENGTH = Length;
+	// The number of state words in the register.
+	constexpr static size_t WORD_COUNT = (Length + 63) / 64;
+	// The mask of the valid bits in the top state word.
+	constexpr static uint64_t TOP_MASK = Length % 64 == 0 ? ~0ULL
+		: (1ULL << (Length % 64)) - 1;
+	// The tap masks of the register, one per state word.
+	constexpr static std::array<uint64_t, WORD_COUNT> TAP_MASKS = []() {
+		std::array<uint64_t, WORD_COUNT> masks = {};
+		((masks[(Length - Taps) / 64] |= 1ULL << ((Length - Taps) % 64)), ...);
+		return masks;
+	}();
+	// Whether the taps allow the byte-wide step: shifted up by 7 steps, they
+	// must stay in the lowest word and clear of the 8 output bits.
+	constexpr static bool BYTE_STEP = ((Length - Taps + 7 < 64
+		&& Length - Taps + 7 < Length - 8) && ...);
+	// The byte-wide feedback table, indexed by output byte; each set bit j of
+	// the byte leaves the taps shifted up by the j steps which followed it.
+	// All zeros when the byte-wide step does not apply.
+	constexpr static std::array<uint64_t, 256> FEEDBACK_TABLE = []() {
+		std::array<uint64_t, 256> table = {};
+		if (BYTE_STEP) {
+			for (size_t b = 0; b < 256; b++) {
+				for (size_t j = 0; j < 8; j++) {
+					if ((b >> j) & 0x01) {
+						table[b] ^= TAP_MASKS[0] << j;
+					}
+				}
+			}
+		}
+		return table;
+	}();
+
+	/*
+	Initialize this GLFSR's state.
+	Parameter: const SHA512Digest& stateDigest - The digest whose bits fill the
+	state, repeated to the length of the register.
+	*/
+	void seed(const SHA512Digest& stateDigest) {
+		GLFSRFillState(stateDigest, m_state.data(), WORD_COUNT, TOP_MASK);
+	}
+	/*
+	Advance this GLFSR by a single step.
+	Returns: bool - The bit shifted out of the top of the register.
+	*/
+	bool step() {
+		bool outputBit = (bool)((m_state[WORD_COUNT - 1]
+			>> ((Length - 1) % 64)) & 0x01);
+		for (size_t i = WORD_COUNT - 1; i > 0; i--) {
+			m_state[i] = (m_state[i] << 1) | (m_state[i - 1] >> 63);
+		}
+		m_state[0] <<= 1;
+		m_state[WORD_COUNT - 1] &= TOP_MASK;
+		if (outputBit) {
+			for (size_t i = 0; i < WORD_COUNT; i++) {
+				m_state[i] ^= TAP_MASKS[i];
+			}
+		}
+		return outputBit;
+	}
+	/*
+	Generate a pseudo-random byte of output data from this GLFSR, 8 steps at
+	once if its taps allow the byte-wide step.
+	Returns: uint8_t - The next 8 output bits, the first in the most
+	significant position.
+	*/
+	uint8_t generate() {
+		if constexpr (!BYTE_STEP) {
+			uint8_t byte = 0x00;
+			for (size_t bit = 0; bit < 8; bit++) {
+				byte = (uint8_t)((byte << 1) | (uint8_t)step());
+			}
+			return byte;
+		}
+		else {
+			constexpr size_t OUTPUT_WORD = (Length - 8) / 64;
+			constexpr size_t OUTPUT_SHIFT = (Length - 8) % 64;
+			uint64_t outputBits = m_state[OUTPUT_WORD] >> OUTPUT_SHIFT;
+			if constexpr (OUTPUT_SHIFT > 56) {
+				outputBits |= m_state[OUTPUT_WORD + 1] << (64 - OUTPUT_SHIFT);
+			}
+			uint8_t byte = (uint8_t)outputBits;
+			for (size_t i = WORD_COUNT - 1; i > 0; i--) {
+				m_state[i] = (m_state[i] << 8) | (m_state[i - 1] >> 56);
+			}
+			m_state[0] <<= 8;
+			m_state[WORD_COUNT - 1] &= TOP_MASK;
+			m_state[0] ^= FEEDBACK_TABLE[byte];
+			return byte;
+		}
+	}
+	/*
+	Get the current state of this GLFSR.
+	Returns: const std::array<uint64_t, WORD_COUNT>& - The state words of the
+	register, least significant word first.
+	*/
+	const std::array<uint64_t, WORD_COUNT>& getState() const {
+		return m_state;
+	}
+
+private:
+	// The current state words of the register, least significant word first.
+	std::array<uint64_t, WORD_COUNT> m_state = {};
+};
+
+// The fixed GLFSR type of each entry of GLFSR_CONFIGS, in the same order, so
+// that alternative i of the variant is configuration i.
+using FixedGLFSRVariant = std::variant<
+	FixedGLFSR<1024, 1024, 1015, 1002, 1001>,
+	FixedGLFSR<777, 777, 776, 767, 761>,
+	FixedGLFSR<777, 777, 748>,
+	FixedGLFSR<667, 667, 664, 660, 659>,
+	FixedGLFSR<666, 666, 664, 659, 656>,
+	FixedGLFSR<665, 665, 661, 659, 654>,
+	FixedGLFSR<665, 665, 632>,
+	FixedGLFSR<512, 512, 510, 507, 504>,
+	FixedGLFSR<511, 511, 509, 503, 501>,
+	FixedGLFSR<511, 511, 501>,
+	FixedGLFSR<444, 444, 435, 432, 431>,
+	FixedGLFSR<333, 333, 331, 329, 325>,
+	FixedGLFSR<333, 333, 331>,
+	FixedGLFSR<303, 303, 297, 291, 290>,
+	FixedGLFSR<256, 256, 254, 251, 246>,
+	FixedGLFSR<222, 222, 220, 217, 214>>;
+
+// The fixed GLFSR type of a configuration.
+template <size_t Config>
+using FixedGLFSRType = std::variant_alternative_t<Config, FixedGLFSRVariant>;
+
+/*
+Construct the fixed GLFSR of a configuration through a dispatch table over the
+alternatives of FixedGLFSRVariant.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+Returns: FixedGLFSRVariant - The unseeded fixed GLFSR of the configuration.
+*/
+extern FixedGLFSRVariant makeFixedGLFSR(size_t);
+
+/*
+A Galois linear feedback shift register whose state is packed into 64-bit
+words. Bit i of the register is bit (i % 64) of word (i / 64); the output bit is
+the highest bit of the register and the feedback taps are stored as word masks.
+*/
+class GLFSR {
+public:
+	/*
+	Construct a GLFSR whose state and taps are allocated from a memory
+	resource.
+	Parameter: std::pmr::memory_resource* resource - The memory resource to
+	allocate from, the global heap by default.
+	*/
+	explicit GLFSR(std::pmr::memory_resource*
+		= std::pmr::get_default_resource());
+	/*
+	Initialize this GLFSR's state and taps.
+	Parameter: size_t config - The index of this GLFSR's entry in
+	GLFSR_CONFIGS.
+	Parameter: const SHA512Digest& stateDigest - The digest whose bits fill the
+	state, repeated to the length of the register.
+	*/
+	void seed(size_t, const SHA512Digest&);
+	/*
+	Advance this GLFSR by a single step.
+	Returns: bool - The bit shifted out of the top of the register.
+	*/
+	bool step();
+	/*
+	Generate a pseudo-random byte of output data from this GLFSR by advancing it
+	8 steps at once. The 8 output bits are read straight from the top of the
+	register and the feedback of all 8 steps is applied from this GLFSR's
+	configuration's feedback table.
+	Returns: uint8_t - The next 8 output bits, the first in the most significant
+	position.
+	*/
+	uint8_t generate();
+	/*
+	Generate a pseudo-random byte of output data from this GLFSR by advancing it
+	one step at a time; the reference for generate().
+	Returns: uint8_t - The next 8 output bits, the first in the most significant
+	position.
+	*/
+	uint8_t generateSerial();
+	/*
+	Advance this GLFSR by a number of steps in time logarithmic in the number
+	of steps, without generating its output.
+	Parameter: uint64_t steps - The number of steps to advance by.
+	*/
+	void jump(uint64_t);
+	/*
+	Advance this GLFSR by multiplying its state by a jump polynomial of its
+	configuration, which may be shared by many GLFSRs.
+	Parameter: const std::vector<uint64_t>& jumpPolynomial - The jump
+	polynomial from GLFSRJumpPolynomial.
+	*/
+	void applyJump(const std::vector<uint64_t>&);
+	/*
+	Free this GLFSR's memory.
+	*/
+	void clear();
+	/*
+	Get the configuration of this GLFSR.
+	Returns: size_t - The index of this GLFSR's entry in GLFSR_CONFIGS.
+	*/
+	size_t getConfig() const;
+	/*
+	Get the current state of this GLFSR.
+	Returns: const std::pmr::vector<uint64_t>& - The state words of the
+	register, least significant word first.
+	*/
+	const std::pmr::vector<uint64_t>& getState() const;
+
+private:
+	// The index of this GLFSR's entry in GLFSR_CONFIGS.
+	size_t m_config = 0;
+	// The number of bits in the register.
+	size_t m_length = 0;
+	// The mask of the valid bits in the top state word.
+	uint64_t m_topMask = 0;
+	// The current state words of the register, least significant word first.
+	std::pmr::vector<uint64_t> m_state;
+	// The tap masks of the register, covering only the low words which hold
+	// taps.
+	std::pmr::vector<uint64_t> m_taps;
+	// The feedback table of this register's configuration, indexed by output
+	// byte, or nullptr if its taps are too close to the top of the register
+	// for the byte-wide step.
+	const uint64_t* m_feedback = nullptr;
+};
+
+#endif
\ No newline at end of file
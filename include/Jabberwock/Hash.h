@@ -0,0 +1,86 @@
+/*
+File:		Hash.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@16:02
+Purpose:	Declare the raw SHA-512 digest functions used to seed the Jabberwock
+			PRNG tree.
+*/
+
+#ifndef JABBERWOCK_HASH_H
+#define JABBERWOCK_HASH_H
+
+#include "Utilities.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// The number of bytes in a SHA-512 digest.
+const static size_t SHA512_DIGEST_LENGTH = 64;
+
+// A raw SHA-512 digest; bit i of the digest, counted from the most significant
+// bit of its first byte, is bit i of its hex string's binary representation.
+using SHA512Digest = std::array<uint8_t, SHA512_DIGEST_LENGTH>;
+
+/*
+Compute the raw SHA-512 digest of a run of bytes.
+Parameter: const uint8_t* input - The bytes to hash.
+Parameter: size_t length - The number of bytes to hash.
+Returns: SHA512Digest - The 64-byte digest.
+*/
+extern SHA512Digest SHA512Raw(const uint8_t*, size_t);
+/*
+Compute the raw SHA-512 digest of a string.
+Parameter: std::string_view input - The string to hash.
+Returns: SHA512Digest - The 64-byte digest.
+*/
+extern SHA512Digest SHA512Raw(std::string_view);
+/*
+Compute the raw SHA-512 digests of a run of equal-length messages. Messages of
+equal length pad to the same number of blocks, so groups of 4 are hashed
+together, one per 64-bit lane of an AVX2 vector, with the widest supported
+instruction set.
+Parameter: const uint8_t* inputs - The messages to hash, each length bytes
+long, one after another.
+Parameter: size_t length - The number of bytes in each message.
+Parameter: size_t count - The number of messages.
+Parameter: SHA512Digest* digests - The count digests to fill, in the order of
+the messages.
+*/
+extern void SHA512RawMany(const uint8_t*, size_t, size_t, SHA512Digest*);
+/*
+Compute the raw SHA-512 digests of a run of equal-length messages with a
+selected instruction set.
+Parameter: const uint8_t* inputs - The messages to hash, each length bytes
+long, one after another.
+Parameter: size_t length - The number of bytes in each message.
+Parameter: size_t count - The number of messages.
+Parameter: SHA512Digest* digests - The count digests to fill, in the order of
+the messages.
+Parameter: InstructionSet instructionSet - The instruction set to hash with;
+sets wider than the processor supports are narrowed to the widest supported
+set, and sets without a multi-buffer kernel hash one message at a time.
+*/
+extern void SHA512RawMany(const uint8_t*, size_t, size_t, SHA512Digest*,
+	InstructionSet);
+/*
+Read a bit of a SHA-512 digest.
+Parameter: const SHA512Digest& digest - The digest.
+Parameter: size_t index - The index of the bit, from the most significant bit
+of the first byte.
+Returns: bool - The bit.
+*/
+extern bool digestBit(const SHA512Digest&, size_t);
+/*
+Read a run of up to 8 bits of a SHA-512 digest as an integer, the first bit in
+the most significant position; bits 508 to 511 are the low 4 bits of the last
+byte.
+Parameter: const SHA512Digest& digest - The digest.
+Parameter: size_t first - The index of the first bit.
+Parameter: size_t count - The number of bits to read.
+Returns: uint8_t - The bits.
+*/
+extern uint8_t digestBits(const SHA512Digest&, size_t, size_t);
+
+#endif
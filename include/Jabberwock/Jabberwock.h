@@ -8,30 +8,247 @@ Purpose:	Declare the wrapper class of the Jabberwock PRNG library.
 #ifndef JABBERWOCK_JABBERWOCK_H
 #define JABBERWOCK_JABBERWOCK_H
 
+#include "CodeGenerator.h"
+#include "LeafBank.h"
+#include "NodeArena.h"
 #include "Nodes.h"
+#include "ThreadPool.h"
+#include "TreeProgram.h"
+
+#include <istream>
+#include <ostream>
+#include <span>
+
+// The number of bytes the Jabberwock PRNG evaluates its tree program over at
+// once when generating in bulk.
+const static size_t JABBERWOCK_BLOCK_LENGTH = 256;
+// The number of bytes each subtree generates per batch of parallel work.
+const static size_t JABBERWOCK_PARALLEL_LENGTH = 1 << 14;
+// The number of bytes of output in each substream of a Jabberwock PRNG.
+const static uint64_t JABBERWOCK_SUBSTREAM_LENGTH = 1ULL << 48;
+// The number of substreams of a Jabberwock PRNG, which together span the
+// 64-bit offsets of its output.
+const static uint64_t JABBERWOCK_SUBSTREAM_COUNT = 1ULL << 16;
 
 // The main wrapper class of the Jabberwock PRNG library.
 class Jabberwock {
 public:
+	// The shape and memory of a seeded Jabberwock PRNG tree.
+	struct Statistics {
+		// The number of nodes of each type, indexed by NodeType.
+		size_t nodeCounts[4];
+		// The number of levels from the root to the deepest GLFSRs.
+		size_t depth;
+		// The number of GLFSRs of each configuration, indexed like
+		// GLFSR_CONFIGS.
+		std::vector<size_t> configCounts;
+		// The number of bytes of GLFSR state, without padding lanes.
+		size_t stateBytes;
+		// The number of heap bytes held for the tree: the leaf banks, tree
+		// programs and block buffers of its subtrees, and the node arena.
+		size_t heapBytes;
+		// The number of subtrees the tree is evaluated in.
+		size_t subtreeCount;
+	};
+	// The time a Jabberwock PRNG has spent generating, by node type. Times are
+	// only collected when the library is built with JABBERWOCK_PROFILE
+	// defined, and are zero otherwise.
+	struct Profile {
+		// The time spent in nodes of each type, in nanoseconds, indexed by
+		// NodeType: stepping GLFSRs, and combining the outputs of gates.
+		uint64_t nanoseconds[4];
+		// The number of bytes generated while the times were collected.
+		uint64_t byteCount;
+	};
+
 	/*
-	Initialize the Jabberwock PRNG's memory.
+	Initialize the Jabberwock PRNG's memory, move the GLFSRs of its tree into
+	its leaf bank and compile the gates of its tree into its tree program. Any
+	previous seeding is cleared first, and the tree is built in the blocks of
+	the PRNG's node arena left over from earlier seedings.
 	Parameter: const std::string& seed - The seed data for the PRNG.
 	Parameter: unsigned int levelCount - The number of levels for the PRNG tree.
 	*/
 	void seed(const std::string&, unsigned int);
 	/*
+	Set the number of threads the Jabberwock PRNG seeds and evaluates its tree
+	with, from the next seeding on. With more than one thread, the subtrees of
+	the root are seeded concurrently once their seeds are derived, each gets
+	its own leaf bank and tree program, and bulk generation hands the subtrees
+	to worker threads and XORs their blocks together; the output is the same
+	as with one thread.
+	Parameter: unsigned int threadCount - The number of threads, including the
+	calling thread.
+	*/
+	void setThreadCount(unsigned int);
+	/*
+	Get the number of threads the Jabberwock PRNG evaluates its tree with.
+	Returns: unsigned int - The number of threads, including the calling
+	thread.
+	*/
+	unsigned int getThreadCount() const;
+	/*
 	Get a pseudo-random byte of output from the Jabberwock PRNG.
 	Returns: uint8_t - A pseudo-random byte.
 	*/
 	uint8_t generate();
 	/*
-	Free the Jabberwock PRNG's memory.
+	Fill a buffer with pseudo-random bytes from the Jabberwock PRNG; the same
+	bytes as as many calls to generate(), evaluated a block at a time.
+	Parameter: uint8_t* output - The buffer to fill.
+	Parameter: size_t length - The number of bytes to generate.
+	*/
+	void generate(uint8_t*, size_t);
+	/*
+	Fill a span with pseudo-random bytes from the Jabberwock PRNG.
+	Parameter: std::span<uint8_t> output - The bytes to fill.
+	*/
+	void generate(std::span<uint8_t>);
+	/*
+	Skip bytes of the Jabberwock PRNG's output without generating them, in time
+	logarithmic in the number of bytes. Every node is a gate over GLFSR outputs,
+	so skipping n bytes is jumping every GLFSR ahead by 8n steps.
+	Parameter: uint64_t count - The number of bytes to skip.
+	*/
+	void discard(uint64_t);
+	/*
+	Move to a byte offset in the Jabberwock PRNG's output, so that the next
+	generated byte is the one at that offset after seeding.
+	Parameter: uint64_t offset - The offset to move to.
+	*/
+	void seek(uint64_t);
+	/*
+	Get the Jabberwock PRNG's offset in its output.
+	Returns: uint64_t - The offset of the next byte to be generated.
+	*/
+	uint64_t getPosition() const;
+	/*
+	Write the Jabberwock PRNG's seeded state to a binary snapshot: the layout
+	and GLFSR states of each subtree's leaf bank, each subtree's tree program
+	and the position in the output. Loading the snapshot continues the same
+	output without seeding.
+	Parameter: std::ostream& output - The stream to write to.
+	Returns: bool - Whether the snapshot was written; the PRNG must be seeded
+	and the stream writable.
+	*/
+	bool save(std::ostream&) const;
+	/*
+	Replace the Jabberwock PRNG's state with a snapshot written by save(). The
+	snapshot keeps the subtrees it was saved with, which are evaluated in
+	parallel if this PRNG has more than one thread.
+	Parameter: std::istream& input - The stream to read from.
+	Returns: bool - Whether a valid snapshot of this format version was read;
+	on failure the PRNG is left cleared.
+	*/
+	bool load(std::istream&);
+	/*
+	Copy the Jabberwock PRNG's seeded state into another PRNG, which then
+	generates the same output independently. Once seeded, the PRNG's state is
+	its subtrees' leaf banks and tree programs, so the copy is one block copy
+	of each lane group's states and of each program's instructions; the
+	feedback tables of the GLFSR configurations are shared.
+	Parameter: Jabberwock& copy - The PRNG to copy into, whose previous state
+	is cleared; its thread count is replaced by this PRNG's.
+	Returns: bool - Whether the state was copied; the PRNG must be seeded.
+	*/
+	bool clone(Jabberwock&) const;
+	/*
+	Derive an independent generator for one substream of the Jabberwock PRNG's
+	output. Substream i is the run of JABBERWOCK_SUBSTREAM_LENGTH bytes from
+	offset i * JABBERWOCK_SUBSTREAM_LENGTH, so substreams never overlap, and
+	each is a clone of this PRNG jumped ahead to its offset, without seeding.
+	Each of N threads can take substream 0 to N - 1 of one seeded PRNG and
+	generate from it without sharing, with the same result on every run.
+	Parameter: uint64_t index - The index of the substream, below
+	JABBERWOCK_SUBSTREAM_COUNT.
+	Parameter: Jabberwock& stream - The PRNG to set to the start of the
+	substream, whose previous state is cleared.
+	Returns: bool - Whether the substream was derived; the PRNG must be seeded
+	and the index in range.
+	*/
+	bool substream(uint64_t, Jabberwock&) const;
+	/*
+	Write the Jabberwock PRNG's seeded tree out as a standalone C++ header
+	with a CodeGenerator. The header's class generates the PRNG's output from
+	its current position with straight-line code and without the library, for
+	deployments which keep one seed for good.
+	Parameter: std::ostream& output - The stream to write to.
+	Parameter: const std::string& className - The name of the generated class.
+	Returns: bool - Whether the header was written; the PRNG must be seeded and
+	the class name a C++ identifier.
+	*/
+	bool emitSource(std::ostream&, const std::string&) const;
+	/*
+	Describe the Jabberwock PRNG's seeded tree: its nodes by type, depth,
+	GLFSR configurations, state and heap memory. Seeded trees are held
+	compiled, so the description is read from the leaf banks and tree
+	programs rather than from nodes.
+	Parameter: Statistics& statistics - Set to the tree's statistics.
+	Returns: bool - Whether the statistics were read; the PRNG must be seeded.
+	*/
+	bool getStatistics(Statistics&) const;
+	/*
+	Get the time the Jabberwock PRNG has spent generating by node type since
+	it was seeded or the profile was reset, which is only collected when the
+	library is built with JABBERWOCK_PROFILE defined. Generating in bulk times
+	whole blocks, so it attributes time more precisely than generating byte by
+	byte, where the timers themselves dominate.
+	Returns: Profile - The collected times.
+	*/
+	Profile getProfile() const;
+	/*
+	Zero the times the Jabberwock PRNG has collected.
+	*/
+	void resetProfile();
+	/*
+	Free the Jabberwock PRNG's memory. The nodes of the tree are freed at once
+	by zeroing and rewinding the node arena, which keeps its blocks for the
+	next seeding.
 	*/
 	void clear();
 
 private:
+	// A part of the Jabberwock PRNG tree whose output is XORed into the
+	// output of the PRNG; the whole tree, or one subtree of the root.
+	struct Subtree {
+		// The leaf bank which steps the GLFSRs of the subtree.
+		LeafBank bank;
+		// The compiled gates of the subtree, which replace its nodes once
+		// compiled.
+		TreeProgram program;
+		// The leaf bank's output rows for the block being generated.
+		std::vector<uint8_t> blockOutputs;
+		// The subtree's output for the batch being generated in parallel.
+		std::vector<uint8_t> output;
+	};
+
+	/*
+	Generate a run of a compiled subtree's output a block at a time.
+	Parameter: Subtree& subtree - The subtree to generate from.
+	Parameter: uint8_t* output - The buffer to fill.
+	Parameter: size_t length - The number of bytes to generate.
+	*/
+	static void generateSubtree(Subtree&, uint8_t*, size_t);
+
+	// The arena which the nodes of the Jabberwock PRNG tree are allocated in.
+	NodeArena m_arena;
 	// The root node of the Jabberwock PRNG tree.
-	XORNode m_root;
+	XORNode m_root{ &m_arena };
+	// The parts of the Jabberwock PRNG tree which are evaluated separately.
+	std::vector<Subtree> m_subtrees;
+	// Whether every subtree was compiled into a tree program.
+	bool m_compiled = false;
+	// The number of threads to evaluate the tree with.
+	unsigned int m_threadCount = 1;
+	// The worker threads which evaluate the subtrees in parallel.
+	ThreadPool m_pool;
+	// The offset of the next byte to be generated.
+	uint64_t m_position = 0;
+	// The time spent XORing the outputs of parallel subtrees together, in
+	// nanoseconds.
+	uint64_t m_rootNanoseconds = 0;
+	// The number of bytes generated since the profile was reset.
+	uint64_t m_profileBytes = 0;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,234 @@
+/*
+File:		LeafBank.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@10:48
+Purpose:	Declare the leaf bank, which steps the GLFSRs of a Jabberwock PRNG
+			tree together in SIMD lanes and combines them for their gates.
+*/
+
+#ifndef JABBERWOCK_LEAFBANK_H
+#define JABBERWOCK_LEAFBANK_H
+
+#include "Nodes.h"
+#include "Utilities.h"
+
+#include <istream>
+#include <ostream>
+
+/*
+A bank of the GLFSRs at the bottom of a Jabberwock PRNG tree. GLFSRs sharing a
+configuration are stored lane by lane, so that word w of every GLFSR in a group
+is contiguous and a whole group advances by a byte with vector shifts. Each
+gate over the GLFSRs owns an 8-byte slot that its GLFSRs write their outputs
+into, and the slots of all gates of one type are combined with vector AND, OR
+or XOR folds.
+*/
+class LeafBank {
+public:
+	/*
+	Add a gate and its GLFSRs to this leaf bank. The GLFSRs' states are copied
+	into the bank, which then advances them in their place.
+	Parameter: NodeType type - The type of the gate.
+	Parameter: const std::vector<const GLFSR*>& leaves - The gate's GLFSRs.
+	Parameter: size_t& index - Set to the index of the gate among the gates of
+	its type.
+	Returns: bool - Whether the gate was added; gates with more than 8 GLFSRs or
+	GLFSRs without a byte-wide step cannot be banked.
+	*/
+	bool addGate(NodeType, const std::vector<const GLFSR*>&, size_t&);
+	/*
+	Lay out the GLFSRs added to this leaf bank in their lane groups and select
+	the widest supported instruction set; must be called after the last gate is
+	added and before the first step.
+	*/
+	void finalize();
+	/*
+	Advance every GLFSR in this leaf bank by a byte and combine the outputs of
+	each gate's GLFSRs.
+	*/
+	void step();
+	/*
+	Advance every GLFSR in this leaf bank by a block of bytes, collecting the
+	combined output of each gate over the block into its own row.
+	Parameter: uint8_t* outputs - The rows to fill, one of length bytes per
+	output in getOutputCount(), in the order of getOutputIndex().
+	Parameter: size_t length - The number of bytes in the block.
+	*/
+	void stepBlock(uint8_t*, size_t);
+	/*
+	Advance every GLFSR in this leaf bank by a number of bytes without
+	generating them, in time logarithmic in the number of bytes. Each group
+	computes one jump polynomial for all of its lanes.
+	Parameter: uint64_t count - The number of bytes to advance by.
+	*/
+	void jump(uint64_t);
+	/*
+	Return every GLFSR in this leaf bank to its state when it was finalized.
+	*/
+	void reset();
+	/*
+	Get the combined output byte of a gate from the last step.
+	Parameter: NodeType type - The type of the gate.
+	Parameter: size_t index - The index of the gate among the gates of its type.
+	Returns: uint8_t - The gate's output byte.
+	*/
+	uint8_t getOutput(NodeType, size_t) const;
+	/*
+	Get the position of a gate's combined output in this leaf bank's outputs.
+	Parameter: NodeType type - The type of the gate.
+	Parameter: size_t index - The index of the gate among the gates of its type.
+	Returns: size_t - The index of the gate's word in getOutputs().
+	*/
+	size_t getOutputIndex(NodeType, size_t) const;
+	/*
+	Get the combined outputs of every gate from the last step.
+	Returns: const uint64_t* - The gates' outputs, one per word in the low byte,
+	valid until the next finalize or clear.
+	*/
+	const uint64_t* getOutputs() const;
+	/*
+	Get the number of outputs of this leaf bank, including its padding.
+	Returns: size_t - The number of words in getOutputs().
+	*/
+	size_t getOutputCount() const;
+	/*
+	Get the instruction set this leaf bank steps its GLFSRs with.
+	Returns: InstructionSet - The instruction set in use.
+	*/
+	InstructionSet getInstructionSet() const;
+	/*
+	Select the instruction set this leaf bank steps its GLFSRs with; sets wider
+	than the processor supports are narrowed to the widest supported set.
+	Parameter: InstructionSet instructionSet - The instruction set to use.
+	*/
+	void setInstructionSet(InstructionSet);
+	/*
+	Write this finalized leaf bank's layout and the current and initial states
+	of its GLFSRs to a snapshot.
+	Parameter: std::ostream& output - The stream to write to.
+	*/
+	void save(std::ostream&) const;
+	/*
+	Replace this leaf bank with one read from a snapshot, finalized and ready
+	to step.
+	Parameter: std::istream& input - The stream to read from.
+	Returns: bool - Whether a valid leaf bank was read; on failure this leaf
+	bank is left cleared.
+	*/
+	bool load(std::istream&);
+	/*
+	Free this leaf bank's memory.
+	*/
+	void clear();
+
+	// A group of GLFSRs sharing a configuration, stored lane by lane.
+	struct Group {
+		// The index of the group's entry in GLFSR_CONFIGS.
+		size_t config = 0;
+		// The number of bits in each register.
+		size_t length = 0;
+		// The number of state words in each register.
+		size_t wordCount = 0;
+		// The mask of the valid bits in each register's top state word.
+		uint64_t topMask = 0;
+		// The feedback table of the group's configuration.
+		const uint64_t* feedback = nullptr;
+		// The number of lanes, padded to a multiple of 4 with empty registers.
+		size_t laneCount = 0;
+		// The state words; word w of lane l is at w * laneCount + l.
+		std::vector<uint64_t> state;
+		// The state words when the group was laid out.
+		std::vector<uint64_t> initialState;
+		// The offset of each lane's output byte in the gate slots.
+		std::vector<uint32_t> destinations;
+		// The output bytes of the last step, one per lane.
+		std::vector<uint8_t> outputs;
+	};
+
+	/*
+	Get the lane groups of this finalized leaf bank.
+	Returns: const std::vector<Group>& - The groups, one per configuration in
+	use, in configuration order.
+	*/
+	const std::vector<Group>& getGroups() const;
+	/*
+	Get the number of gates of a type in this leaf bank.
+	Parameter: NodeType type - The type of the gates.
+	Returns: size_t - The number of gates of the type, without padding.
+	*/
+	size_t getGateCount(NodeType) const;
+	/*
+	Get the number of GLFSRs in a lane group of this leaf bank.
+	Parameter: const Group& group - The group, one of getGroups().
+	Returns: size_t - The number of the group's lanes which hold a gate's
+	GLFSR rather than padding.
+	*/
+	size_t getLeafCount(const Group&) const;
+	/*
+	Get the number of heap bytes this leaf bank holds.
+	Returns: size_t - The bytes of the bank's groups, slots and outputs.
+	*/
+	size_t getHeapBytes() const;
+	/*
+	Get the time this leaf bank has spent stepping its GLFSRs or combining the
+	slots of its gates of one type, collected only when the library is built
+	with JABBERWOCK_PROFILE defined.
+	Parameter: NodeType type - The type of node to get the time of.
+	Returns: uint64_t - The time in nanoseconds since the last resetProfile.
+	*/
+	uint64_t getNanoseconds(NodeType) const;
+	/*
+	Zero the times this leaf bank has collected.
+	*/
+	void resetProfile();
+
+private:
+	// A GLFSR waiting to be laid out in its group.
+	struct PendingLeaf {
+		// The index of the GLFSR's entry in GLFSR_CONFIGS.
+		size_t config;
+		// The state words of the GLFSR.
+		std::vector<uint64_t> state;
+		// The type of the GLFSR's gate.
+		NodeType type;
+		// The index of the GLFSR's gate among the gates of its type.
+		size_t gate;
+		// The index of the GLFSR among its gate's GLFSRs.
+		size_t position;
+	};
+
+	/*
+	Lay out the output slots of this leaf bank's gates from their counts.
+	Returns: size_t - The index of the slot which the padding lanes write to.
+	*/
+	size_t layoutSlots();
+	/*
+	Set up an empty lane group for a GLFSR configuration.
+	Parameter: Group& group - The group to set up.
+	Parameter: size_t config - The index of the configuration in
+	GLFSR_CONFIGS.
+	Parameter: size_t laneCount - The number of lanes in the group.
+	*/
+	static void initializeGroup(Group&, size_t, size_t);
+
+	// The GLFSRs added since the last finalize.
+	std::vector<PendingLeaf> m_pending;
+	// The lane groups of GLFSRs, one per configuration in use.
+	std::vector<Group> m_groups;
+	// The number of gates of each gate type.
+	size_t m_gateCounts[3] = { 0, 0, 0, };
+	// The index of the first slot of each gate type.
+	size_t m_gateStarts[3] = { 0, 0, 0, };
+	// The 8-byte output slots of the gates, grouped by type, followed by the
+	// slot which the padding lanes write to.
+	std::vector<uint64_t> m_slots;
+	// The combined outputs of the gates, in the low byte of each word.
+	std::vector<uint64_t> m_outputs;
+	// The instruction set used to step the GLFSRs and combine the slots.
+	InstructionSet m_instructionSet = InstructionSet::SCALAR;
+	// The time spent in each type of node, in nanoseconds, indexed by
+	// NodeType.
+	uint64_t m_nanoseconds[4] = { 0, 0, 0, 0, };
+};
+
+#endif
\ No newline at end of file
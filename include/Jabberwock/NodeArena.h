@@ -0,0 +1,107 @@
+/*
+File:		NodeArena.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@14:20
+Purpose:	Declare the node arena, which allocates the nodes of a Jabberwock
+			PRNG tree and their GLFSR states from reusable blocks of memory.
+*/
+
+#ifndef JABBERWOCK_NODEARENA_H
+#define JABBERWOCK_NODEARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// The default number of bytes in each block of a node arena.
+const static size_t NODE_ARENA_BLOCK_SIZE = 1 << 18;
+
+/*
+A bump allocator for the nodes of a Jabberwock PRNG tree and the containers
+inside them. Memory is handed out in order from a list of blocks and is never
+freed individually; reset() zeroes and rewinds every block at once, after
+which the next tree is built in the same blocks without touching the global
+allocator. Objects in the arena are abandoned rather than destroyed, so they
+must keep all of their memory in the arena too. Allocation is serialized by a
+lock, so that sibling subtrees can be seeded into the same arena concurrently;
+reset() and release() must not overlap any allocation.
+*/
+class NodeArena : public std::pmr::memory_resource {
+public:
+	/*
+	Construct an object of a node type in this arena.
+	Returns: T* - The new object, constructed with a pointer to this arena.
+	*/
+	template <typename T>
+	T* create() {
+		return new (allocate(sizeof(T), alignof(T))) T(this);
+	}
+	/*
+	Zero every byte handed out by this arena and rewind it to its first block,
+	keeping its blocks for reuse. Every object in the arena is abandoned.
+	*/
+	void reset();
+	/*
+	Free every block of this arena.
+	*/
+	void release();
+	/*
+	Get the number of bytes handed out by this arena since it was last reset.
+	Returns: size_t - The number of bytes in use, including alignment padding.
+	*/
+	size_t getUsed() const;
+	/*
+	Get the number of bytes in this arena's blocks.
+	Returns: size_t - The capacity of this arena.
+	*/
+	size_t getCapacity() const;
+
+private:
+	// A block of memory handed out in order.
+	struct Block {
+		// The memory of the block.
+		std::unique_ptr<std::byte[]> memory;
+		// The number of bytes in the block.
+		size_t size;
+		// The number of bytes handed out from the start of the block.
+		size_t used;
+	};
+
+	/*
+	Hand out memory from the current block under this arena's lock.
+	Parameter: size_t bytes - The number of bytes to allocate.
+	Parameter: size_t alignment - The alignment of the memory.
+	Returns: void* - The allocated memory.
+	*/
+	void* do_allocate(size_t, size_t) override;
+	/*
+	Hand out memory from the current block, moving on to the next block or
+	adding a new one when it is full; the caller holds this arena's lock.
+	Parameter: size_t bytes - The number of bytes to allocate.
+	Parameter: size_t alignment - The alignment of the memory.
+	Returns: void* - The allocated memory.
+	*/
+	void* allocateLocked(size_t, size_t);
+	/*
+	Do nothing; arena memory is only reclaimed by reset() or release().
+	*/
+	void do_deallocate(void*, size_t, size_t) override;
+	/*
+	Check whether another memory resource is this arena.
+	Parameter: const std::pmr::memory_resource& other - The other resource.
+	Returns: bool - Whether memory from one can be freed by the other.
+	*/
+	bool do_is_equal(const std::pmr::memory_resource&) const noexcept override;
+
+	// The blocks of the arena, in the order they are handed out.
+	std::vector<Block> m_blocks;
+	// The index of the block currently handed out from.
+	size_t m_current = 0;
+	// The lock over the blocks while memory is handed out.
+	std::mutex m_mutex;
+};
+
+#endif
@@ -8,18 +8,44 @@ Purpose:	Declare all the types of nodes in the Jabberwock PRNG tree.
 #ifndef JABBERWOCK_NODES_H
 #define JABBERWOCK_NODES_H
 
+#include "GLFSR.h"
+#include "NodeArena.h"
+#include "ThreadPool.h"
+
+#include <memory_resource>
 #include <string>
+#include <string_view>
 #include <vector>
 
+class LeafBank;
+
+// The types of nodes in the Jabberwock PRNG tree.
+enum class NodeType : uint8_t {
+	XOR,
+	AND,
+	OR,
+	GLFSR,
+};
+
 // An abstract node in the Jabberwock PRNG tree.
 class Node {
 public:
 	/*
-	Initialize this node's memory and that of its children.
-	Parameter: const std::string& seed - The seed data for this node.
+	Construct a node whose children and their memory come from an arena.
+	Parameter: NodeArena* arena - The arena of the node's tree.
+	*/
+	explicit Node(NodeArena*);
+	/*
+	Initialize this node's memory and that of its children. The children's
+	seeds are a chain of permutations of this node's seed; given a thread pool,
+	the whole chain is derived first and the children's subtrees are then
+	seeded concurrently, with the same result as seeding them in turn.
+	Parameter: std::string_view seed - The seed data for this node.
 	Parameter: unsigned int - The number of levels in the tree below this node.
+	Parameter: ThreadPool* pool - The thread pool to seed this node's children
+	on, or nullptr to seed them on the calling thread.
 	*/
-	virtual void seed(const std::string&, unsigned int);
+	virtual void seed(std::string_view, unsigned int, ThreadPool* = nullptr);
 	/*
 	Generate a pseudo-random byte of output data from this node.
 	Returns: uint8_t - A pseudo-random byte.
@@ -29,75 +55,150 @@ public:
 	Free this node's memory and that of its children.
 	*/
 	virtual void clear();
+	/*
+	Drop this node's children without visiting them, for when the whole tree
+	is freed at once by resetting its arena.
+	*/
+	void release();
+	/*
+	Move the GLFSRs below this node into a leaf bank. A node whose children are
+	all GLFSRs hands them to the bank as one gate, after which the bank steps
+	them and combines their output for this node's generate().
+	Parameter: LeafBank& bank - The leaf bank to move the GLFSRs into.
+	*/
+	virtual void bankLeaves(LeafBank&);
+	/*
+	Get the type of this node.
+	Returns: NodeType - The type of this node.
+	*/
+	virtual NodeType getType() const = 0;
+	/*
+	Get this node's GLFSR, if it is a GLFSR node.
+	Returns: const GLFSR* - This node's GLFSR, or nullptr if it has none.
+	*/
+	virtual const GLFSR* getGLFSR() const;
+	/*
+	Get the children of this node.
+	Returns: const std::pmr::vector<Node*>& - The set of pointers to this
+	node's children.
+	*/
+	const std::pmr::vector<Node*>& getChildren() const;
+	/*
+	Check whether this node's GLFSR children were moved into a leaf bank.
+	Returns: bool - Whether this node's output is combined by a leaf bank.
+	*/
+	bool isBanked() const;
+	/*
+	Get the index of this node among the gates of its type in its leaf bank.
+	Returns: size_t - The index of this node in its leaf bank.
+	*/
+	size_t getBankIndex() const;
 
 protected:
-	// The set of pointers to this node's children.
-	std::vector<Node*> m_children;
+	// The set of pointers to this node's children, allocated in its arena.
+	std::pmr::vector<Node*> m_children;
+	// The arena which this node's children are allocated in.
+	NodeArena* m_arena;
+	// The leaf bank which combines this node's GLFSR children, or nullptr if
+	// they are not banked.
+	LeafBank* m_bank = nullptr;
+	// The index of this node among the gates of its type in its leaf bank.
+	size_t m_bankIndex = 0;
 };
 
 // An XOR node in the Jabberwock PRNG tree.
 class XORNode : public Node {
 public:
+	using Node::Node;
 	/*
 	Initialize the memory of this XOR node's children.
-	Parameter: const std::string& seed - The seed data for this XOR node.
+	Parameter: std::string_view seed - The seed data for this XOR node.
 	Parameter: unsigned int levelCount - The number of levels in the tree below
 	this XOR node.
+	Parameter: ThreadPool* pool - The thread pool to seed this XOR node's
+	children on, or nullptr to seed them on the calling thread.
 	*/
-	void seed(const std::string&, unsigned int) override;
+	void seed(std::string_view, unsigned int, ThreadPool* = nullptr) override;
 	/*
 	Generate a pseudo-random byte of output data from this XOR node.
 	Returns: uint8_t - The XOR sum of the output bytes of this XOR node's
 	children.
 	*/
 	uint8_t generate() override;
+	/*
+	Get the type of this XOR node.
+	Returns: NodeType - NodeType::XOR.
+	*/
+	NodeType getType() const override;
 };
 
 // An AND node in the Jabberwock PRNG tree.
 class ANDNode : public Node {
 public:
+	using Node::Node;
 	/*
 	Initialize the memory of this AND node's children.
-	Parameter: const std::string& seed - The seed data for this AND node.
+	Parameter: std::string_view seed - The seed data for this AND node.
 	Parameter: unsigned int levelCount - The number of levels in the tree below
 	this AND node.
+	Parameter: ThreadPool* pool - The thread pool to seed this AND node's
+	children on, or nullptr to seed them on the calling thread.
 	*/
-	void seed(const std::string&, unsigned int) override;
+	void seed(std::string_view, unsigned int, ThreadPool* = nullptr) override;
 	/*
 	Generate a pseudo-random byte of output data from this AND node.
 	Returns: uint8_t - The AND product of the output bytes of this AND node's
 	children.
 	*/
 	uint8_t generate() override;
+	/*
+	Get the type of this AND node.
+	Returns: NodeType - NodeType::AND.
+	*/
+	NodeType getType() const override;
 };
 
 // An OR node in the Jabberwock PRNG tree.
 class ORNode : public Node {
 public:
+	using Node::Node;
 	/*
 	Initialize the memory of this OR node's children.
-	Parameter: const std::string& seed - The seed data for this OR node.
+	Parameter: std::string_view seed - The seed data for this OR node.
 	Parameter: unsigned int levelCount - The number of levels in the tree below
 	this OR node.
+	Parameter: ThreadPool* pool - The thread pool to seed this OR node's
+	children on, or nullptr to seed them on the calling thread.
 	*/
-	void seed(const std::string&, unsigned int) override;
+	void seed(std::string_view, unsigned int, ThreadPool* = nullptr) override;
 	/*
 	Generate a pseudo-random byte of output data from this OR node.
 	Returns: uint8_t - The OR gate combination of the output bytes of this OR
 	node's children.
 	*/
 	uint8_t generate() override;
+	/*
+	Get the type of this OR node.
+	Returns: NodeType - NodeType::OR.
+	*/
+	NodeType getType() const override;
 };
 
 // A Galois linear feedback shift register node in the Jabberwock PRNG tree.
 class GLFSRNode : public Node {
 public:
+	/*
+	Construct a GLFSR node whose GLFSR state comes from an arena.
+	Parameter: NodeArena* arena - The arena of the node's tree.
+	*/
+	explicit GLFSRNode(NodeArena*);
 	/*
 	Initialize this GLFSR node's memory.
-	Parameter: const std::string& seed - The seed data for this GLFSR node.
+	Parameter: std::string_view seed - The seed data for this GLFSR node.
 	Parameter: unsigned int - Unused parameter.
+	Parameter: ThreadPool* - Unused parameter.
 	*/
-	void seed(const std::string&, unsigned int) override;
+	void seed(std::string_view, unsigned int, ThreadPool* = nullptr) override;
 	/*
 	Generate a pseudo-random byte of output data from this GLFSR node.
 	Returns: uint8_t - A pseudo-random byte.
@@ -107,12 +208,20 @@ public:
 	Free this GLFSR node's memory.
 	*/
 	void clear() override;
+	/*
+	Get the type of this GLFSR node.
+	Returns: NodeType - NodeType::GLFSR.
+	*/
+	NodeType getType() const override;
+	/*
+	Get this GLFSR node's GLFSR.
+	Returns: const GLFSR* - This node's GLFSR.
+	*/
+	const GLFSR* getGLFSR() const override;
 
 private:
-	// The current state buffer of this node's GLFSR.
-	std::vector<bool> m_state;
-	// The tap buffer of this node's GLFSR.
-	std::vector<bool> m_taps;
+	// This node's word-packed GLFSR.
+	GLFSR m_glfsr;
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,96 @@
+/*
+File:		PackedFormat.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@20:05
+Purpose:	Declare the formats of packed numeric output and the functions which
+			parse their ranges, build their .npy headers and draw their elements
+			from a sampler.
+*/
+
+#ifndef JABBERWOCK_PACKEDFORMAT_H
+#define JABBERWOCK_PACKEDFORMAT_H
+
+#include "Sampler.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// The element types of packed numeric output.
+enum class ElementType : uint8_t {
+	INT32,
+	INT64,
+	FLOAT32,
+	FLOAT64,
+};
+
+// The names of the element types.
+const static std::vector<std::string> ELEMENT_TYPE_NAMES = {
+	"int32",
+	"int64",
+	"float32",
+	"float64",
+};
+// The .npy descriptors of the element types.
+const static std::vector<std::string> NPY_DESCRIPTORS = {
+	"<i4",
+	"<i8",
+	"<f4",
+	"<f8",
+};
+// The number of bytes in each element type.
+const static size_t ELEMENT_SIZES[4] = { 4, 8, 4, 8, };
+// The magic string and version 1.0 at the start of a .npy file.
+const static std::string NPY_MAGIC = std::string("\x93NUMPY\x01\x00", 8);
+// The alignment of the data after a .npy header, so that it may be mapped.
+const static size_t NPY_HEADER_ALIGNMENT = 64;
+
+// The format of packed numeric output.
+struct PackedFormat {
+	// The type of each element.
+	ElementType type;
+	// The range of integer elements, inclusive.
+	int64_t integerMinimum;
+	int64_t integerMaximum;
+	// The range of floating point elements, excluding the maximum.
+	double floatMinimum;
+	double floatMaximum;
+	// Whether to write a .npy header before the elements.
+	bool npy;
+};
+
+/*
+Parse the range of packed numeric output, or set the default range of its
+element type: the whole type for integers, and [0, 1) for floats. Integers must
+fit their type, and float bounds must be finite in their type and distinct
+once narrowed to it.
+Parameter: PackedFormat& format - The format whose type is set, to set the
+range of.
+Parameter: const std::string& minimum - The smallest value, or empty for the
+default range.
+Parameter: const std::string& maximum - The largest value for integers and
+the bound for floats, or empty for the default range.
+Returns: bool - Whether the range was valid for the element type.
+*/
+extern bool parsePackedRange(PackedFormat&, const std::string&,
+	const std::string&);
+/*
+Build the header of a .npy file of a one-dimensional array.
+Parameter: const PackedFormat& format - The format of the elements.
+Parameter: uint64_t count - The number of elements.
+Returns: std::string - The header, padded so that the elements after it start
+at a multiple of NPY_HEADER_ALIGNMENT bytes.
+*/
+extern std::string npyHeader(const PackedFormat&, uint64_t);
+/*
+Draw packed little-endian elements from a sampler.
+Parameter: Sampler& sampler - The sampler to draw the elements with.
+Parameter: const PackedFormat& format - The format of the elements.
+Parameter: uint8_t* output - The buffer to write the elements to, with room
+for count elements.
+Parameter: size_t count - The number of elements to draw.
+*/
+extern void drawPacked(Sampler&, const PackedFormat&, uint8_t*, size_t);
+
+#endif
@@ -0,0 +1,115 @@
+/*
+File:		PrefetchBuffer.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@17:40
+Purpose:	Declare the prefetch buffer, a lock-free ring which a background
+			thread keeps filled with the output of a Jabberwock PRNG.
+*/
+
+#ifndef JABBERWOCK_PREFETCHBUFFER_H
+#define JABBERWOCK_PREFETCHBUFFER_H
+
+#include "Jabberwock.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// The most bytes the producer of a prefetch buffer generates at once.
+const static size_t PREFETCH_REFILL_LENGTH = 1 << 16;
+
+/*
+A ring buffer which a background producer thread keeps filled with the output
+of a clone of a seeded Jabberwock PRNG, so that a read is a copy out of the
+ring rather than an evaluation of the tree. Any number of consumer threads may
+read at once: each read claims the next run of the output with a compare and
+swap, copies it out and releases it in claim order, and the producer refills
+the released space. Threads only block, on atomic waits, when the ring is empty
+or full.
+*/
+class PrefetchBuffer {
+public:
+	// A snapshot of the counters of a prefetch buffer.
+	struct Counters {
+		// The number of generated bytes not yet claimed by a read.
+		uint64_t fillLevel;
+		// The number of reads which found too few bytes and waited.
+		uint64_t underruns;
+		// The number of bytes the producer has generated.
+		uint64_t producedBytes;
+		// The producer's generation rate in bytes per second, over the time it
+		// spent generating rather than waiting for space.
+		double producerThroughput;
+	};
+
+	/*
+	Stop this prefetch buffer's producer.
+	*/
+	~PrefetchBuffer();
+	/*
+	Start filling this prefetch buffer from a clone of a seeded PRNG,
+	replacing any running producer. The buffer's output continues the PRNG's
+	output from its current position.
+	Parameter: const Jabberwock& source - The seeded PRNG to clone.
+	Parameter: size_t capacity - The number of bytes in the ring, rounded up to
+	a power of 2.
+	Returns: bool - Whether the producer was started; the PRNG must be seeded.
+	*/
+	bool start(const Jabberwock&, size_t);
+	/*
+	Copy the next run of the output out of this prefetch buffer, waiting for
+	the producer if the ring holds too little. The run is claimed whole, so it
+	is contiguous in the output even when other threads read at once; runs
+	longer than the ring are copied out as the producer refills it.
+	Parameter: uint8_t* output - The buffer to fill.
+	Parameter: size_t length - The number of bytes to read.
+	Returns: uint64_t - The offset of the first byte read in the PRNG's output,
+	from which a consumer can place its bytes in the whole stream.
+	*/
+	uint64_t read(uint8_t*, size_t);
+	/*
+	Stop and join this prefetch buffer's producer; no read may be in progress.
+	*/
+	void stop();
+	/*
+	Read the counters of this prefetch buffer.
+	Returns: Counters - The current values of the counters.
+	*/
+	Counters getCounters() const;
+
+private:
+	/*
+	Generate into the ring's free space until the buffer is stopped.
+	*/
+	void produce();
+
+	// The clone of the PRNG which the producer generates from.
+	Jabberwock m_generator;
+	// The bytes of the ring; byte i of the output is at i & m_mask.
+	std::vector<uint8_t> m_ring;
+	// The mask of the ring's indices.
+	uint64_t m_mask = 0;
+	// The offset in the PRNG's output of the ring's first byte.
+	uint64_t m_origin = 0;
+	// The producer thread.
+	std::thread m_producer;
+	// The number of bytes generated into the ring.
+	alignas(64) std::atomic<uint64_t> m_written = 0;
+	// The number of bytes claimed by reads.
+	alignas(64) std::atomic<uint64_t> m_claimed = 0;
+	// The number of bytes released by reads, whose space may be refilled.
+	alignas(64) std::atomic<uint64_t> m_released = 0;
+	// Counts the events which may let the producer continue, which it waits
+	// on when the ring is full.
+	alignas(64) std::atomic<uint32_t> m_producerSignal = 0;
+	// Whether the producer should exit.
+	std::atomic<bool> m_stopping = false;
+	// The number of reads which found too few bytes and waited.
+	std::atomic<uint64_t> m_underruns = 0;
+	// The time the producer has spent generating, in nanoseconds.
+	std::atomic<uint64_t> m_producerNanoseconds = 0;
+};
+
+#endif
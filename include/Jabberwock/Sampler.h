@@ -0,0 +1,107 @@
+/*
+File:		Sampler.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@19:45
+Purpose:	Declare the sampler, which draws unbiased bounded integers, floats
+			and characters from the output of a Jabberwock PRNG.
+*/
+
+#ifndef JABBERWOCK_SAMPLER_H
+#define JABBERWOCK_SAMPLER_H
+
+#include "Jabberwock.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// The number of bytes a sampler generates from its PRNG at once.
+const static size_t SAMPLER_BUFFER_LENGTH = 1 << 12;
+
+/*
+A distribution layer over a seeded Jabberwock PRNG which spends as little of
+its output as it can on each symbol. Bytes are generated in bulk into a buffer
+and consumed in order, most significant first, a whole byte at a time: bounded
+integers take the fewest bytes which can hold the bound, mapped by Lemire's
+multiply and shift with rejection; floats take exactly the bytes of their
+mantissa; and alphabets of up to 256 characters take single bytes with
+rejection. Every draw is exactly uniform, and the sampler counts the bytes it
+consumes so that the cost of each symbol can be reported.
+*/
+class Sampler {
+public:
+	/*
+	Construct a sampler over a PRNG, which must outlive it.
+	Parameter: Jabberwock* jabberwock - The seeded PRNG to draw bytes from.
+	*/
+	explicit Sampler(Jabberwock*);
+	/*
+	Draw an integer uniformly below a bound.
+	Parameter: uint64_t bound - The number of possible values, at least 1.
+	Returns: uint64_t - An integer from 0 up to the bound; bounds of 1 consume
+	no bytes.
+	*/
+	uint64_t nextBelow(uint64_t);
+	/*
+	Draw an integer uniformly from a closed range.
+	Parameter: int64_t minimum - The smallest possible value.
+	Parameter: int64_t maximum - The largest possible value, at least the
+	minimum.
+	Returns: int64_t - An integer from the minimum to the maximum.
+	*/
+	int64_t nextInRange(int64_t, int64_t);
+	/*
+	Draw the index of a character of an alphabet uniformly. Alphabets of up to
+	256 characters draw a byte at a time, rejecting the bytes above the largest
+	multiple of the alphabet's size.
+	Parameter: size_t count - The number of characters in the alphabet, at
+	least 1.
+	Returns: size_t - An index from 0 up to the count.
+	*/
+	size_t nextIndex(size_t);
+	/*
+	Draw a float uniformly from a half-open range. The fraction of the range is
+	built from exactly 24 bits, one per bit of a float's mantissa, so every
+	fraction is a multiple of 2^-24 and is exact. The range may be as wide as
+	the whole of the finite floats.
+	Parameter: float minimum - The smallest possible value, finite.
+	Parameter: float maximum - The bound of the range, finite and greater than
+	the minimum.
+	Returns: float - A float from the minimum up to the maximum.
+	*/
+	float nextFloat(float, float);
+	/*
+	Draw a double uniformly from a half-open range, from a fraction of exactly
+	53 bits. The range may be as wide as the whole of the finite doubles.
+	Parameter: double minimum - The smallest possible value, finite.
+	Parameter: double maximum - The bound of the range, finite and greater than
+	the minimum.
+	Returns: double - A double from the minimum up to the maximum.
+	*/
+	double nextDouble(double, double);
+	/*
+	Get the number of PRNG bytes this sampler has consumed, including rejected
+	draws but not bytes generated ahead into its buffer.
+	Returns: uint64_t - The number of bytes consumed since construction.
+	*/
+	uint64_t getConsumedBytes() const;
+
+private:
+	/*
+	Consume bytes from the buffer, refilling it from the PRNG as needed.
+	Parameter: size_t count - The number of bytes to consume, at most 8.
+	Returns: uint64_t - The bytes, the first consumed most significant.
+	*/
+	uint64_t consume(size_t);
+
+	// The PRNG to draw bytes from.
+	Jabberwock* m_jabberwock;
+	// The bytes generated ahead of the draws.
+	std::vector<uint8_t> m_buffer;
+	// The offset of the next byte to consume in the buffer.
+	size_t m_offset;
+	// The number of bytes consumed.
+	uint64_t m_consumedBytes = 0;
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+File:		Snapshot.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@17:05
+Purpose:	Declare the binary snapshot format which a seeded Jabberwock PRNG is
+			saved in and restored from.
+*/
+
+#ifndef JABBERWOCK_SNAPSHOT_H
+#define JABBERWOCK_SNAPSHOT_H
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+
+// The magic number at the start of a Jabberwock PRNG snapshot, "JBWK" in file
+// order.
+const static uint32_t JABBERWOCK_SNAPSHOT_MAGIC = 0x4B57424A;
+// The version of the snapshot format; snapshots of other versions are refused.
+const static uint32_t JABBERWOCK_SNAPSHOT_VERSION = 1;
+// The largest element count a snapshot may give any of its arrays, which keeps
+// a corrupt snapshot from requesting an unbounded allocation.
+const static uint64_t JABBERWOCK_SNAPSHOT_MAXIMUM_COUNT = 1ULL << 20;
+
+/*
+Write an array of unsigned integers to a snapshot, least significant byte first.
+On little-endian processors the array is written in one block.
+Parameter: std::ostream& output - The stream to write to.
+Parameter: const T* values - The integers to write.
+Parameter: size_t count - The number of integers.
+*/
+template <typename T>
+void writeSnapshotValues(std::ostream& output, const T* values, size_t count) {
+	if constexpr (std::endian::native == std::endian::little) {
+		output.write((const char*)values, (std::streamsize)(sizeof(T) * count));
+	}
+	else {
+		for (size_t i = 0; i < count; i++) {
+			char bytes[sizeof(T)];
+			for (size_t j = 0; j < sizeof(T); j++) {
+				bytes[j] = (char)(uint8_t)(values[i] >> (8 * j));
+			}
+			output.write(bytes, sizeof(T));
+		}
+	}
+}
+
+/*
+Write an unsigned integer to a snapshot, least significant byte first.
+Parameter: std::ostream& output - The stream to write to.
+Parameter: T value - The integer to write.
+*/
+template <typename T>
+void writeSnapshotValue(std::ostream& output, T value) {
+	writeSnapshotValues(output, &value, 1);
+}
+
+/*
+Read an array of unsigned integers from a snapshot.
+Parameter: std::istream& input - The stream to read from.
+Parameter: T* values - The integers to fill.
+Parameter: size_t count - The number of integers.
+Returns: bool - Whether every integer was read.
+*/
+template <typename T>
+bool readSnapshotValues(std::istream& input, T* values, size_t count) {
+	if constexpr (std::endian::native == std::endian::little) {
+		input.read((char*)values, (std::streamsize)(sizeof(T) * count));
+	}
+	else {
+		for (size_t i = 0; i < count && input; i++) {
+			uint8_t bytes[sizeof(T)];
+			input.read((char*)bytes, sizeof(T));
+			T value = 0;
+			for (size_t j = 0; j < sizeof(T); j++) {
+				value |= (T)bytes[j] << (8 * j);
+			}
+			values[i] = value;
+		}
+	}
+	return (bool)input;
+}
+
+/*
+Read an unsigned integer from a snapshot.
+Parameter: std::istream& input - The stream to read from.
+Parameter: T& value - The integer to fill.
+Returns: bool - Whether the integer was read.
+*/
+template <typename T>
+bool readSnapshotValue(std::istream& input, T& value) {
+	return readSnapshotValues(input, &value, 1);
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*
+File:		ThreadPool.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@15:10
+Purpose:	Declare the thread pool which the Jabberwock PRNG library spreads
+			independent tasks over.
+*/
+
+#ifndef JABBERWOCK_THREADPOOL_H
+#define JABBERWOCK_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+A fixed set of worker threads which run batches of independent tasks. The
+thread calling run() works on the batch alongside the workers and returns once
+every task is finished; tasks are claimed one at a time so that uneven tasks
+balance across the threads.
+*/
+class ThreadPool {
+public:
+	/*
+	Stop this thread pool's workers.
+	*/
+	~ThreadPool();
+	/*
+	Start this thread pool's workers, replacing any running workers.
+	Parameter: size_t workerCount - The number of worker threads to start; 0
+	runs every task on the calling thread.
+	*/
+	void start(size_t);
+	/*
+	Run a batch of tasks across this thread pool's workers and the calling
+	thread.
+	Parameter: size_t taskCount - The number of tasks in the batch.
+	Parameter: const std::function<void(size_t)>& task - The task, called once
+	with each index from 0 up to the task count.
+	*/
+	void run(size_t, const std::function<void(size_t)>&);
+	/*
+	Stop and join this thread pool's workers.
+	*/
+	void stop();
+	/*
+	Get the number of worker threads in this thread pool.
+	Returns: size_t - The number of workers, not counting the calling thread.
+	*/
+	size_t getWorkerCount() const;
+
+private:
+	/*
+	Wait for batches of tasks and work on them until the pool is stopped.
+	Parameter: uint64_t batch - The number of batches started before the
+	worker, which it skips.
+	*/
+	void work(uint64_t);
+	/*
+	Claim and run tasks of the current batch until none are left.
+	*/
+	void runTasks();
+
+	// The worker threads.
+	std::vector<std::thread> m_workers;
+	// The lock over the batch state shared with the workers.
+	std::mutex m_mutex;
+	// Signalled when a batch is started or the pool is stopped.
+	std::condition_variable m_wake;
+	// Signalled when the last worker finishes a batch.
+	std::condition_variable m_done;
+	// The task of the current batch.
+	const std::function<void(size_t)>* m_task = nullptr;
+	// The number of tasks in the current batch.
+	size_t m_taskCount = 0;
+	// The index of the next unclaimed task of the current batch.
+	std::atomic<size_t> m_nextTask = 0;
+	// The number of workers still working on the current batch.
+	size_t m_busyWorkers = 0;
+	// The number of batches started, which wakes the workers for each batch.
+	uint64_t m_batch = 0;
+	// Whether the workers should exit.
+	bool m_stopping = false;
+};
+
+#endif
@@ -0,0 +1,134 @@
+/*
+File:		TreeProgram.h
+Author:		Keegan MacDonald
+Created:	2026.10.17@13:05
+Purpose:	Declare the tree program, a flattened form of the Jabberwock PRNG
+			tree which is evaluated without virtual calls.
+*/
+
+#ifndef JABBERWOCK_TREEPROGRAM_H
+#define JABBERWOCK_TREEPROGRAM_H
+
+#include "LeafBank.h"
+#include "Nodes.h"
+
+#include <istream>
+#include <ostream>
+
+// The operations of the instructions in a tree program.
+enum class TreeOperation : uint8_t {
+	// Load the combined output of a gate from the leaf bank.
+	LOAD,
+	// Combine a range of earlier results with XOR.
+	XOR,
+	// Combine a range of earlier results with AND.
+	AND,
+	// Combine a range of earlier results with OR.
+	OR,
+};
+
+/*
+A Jabberwock PRNG tree compiled into a flat program. Each gate of the tree
+becomes an instruction, ordered so that every gate comes after its children and
+the root is last. The children of a gate are consecutive in the tree's
+breadth-first order, so each instruction reads its operands as one contiguous
+range of the earlier results. The GLFSR states stay in the leaf bank, which
+steps them in its own contiguous lanes.
+*/
+class TreeProgram {
+public:
+	// An instruction of a tree program, writing the result at its own index.
+	struct Instruction {
+		// The operation of the instruction.
+		TreeOperation op;
+		// The index of the first operand result, or of the gate's output in
+		// the leaf bank for LOAD instructions.
+		uint32_t first;
+		// The number of operand results; unused for LOAD instructions.
+		uint32_t count;
+	};
+
+	/*
+	Compile a tree whose GLFSRs have been moved into a leaf bank.
+	Parameter: const Node& root - The root node of the tree.
+	Parameter: const LeafBank& bank - The finalized leaf bank of the tree.
+	Returns: bool - Whether the tree was compiled; trees with GLFSRs left
+	outside the leaf bank cannot be compiled.
+	*/
+	bool compile(const Node&, const LeafBank&);
+	/*
+	Evaluate this tree program over the leaf bank's outputs from its last step.
+	Parameter: const uint64_t* outputs - The leaf bank's outputs.
+	Returns: uint8_t - The output byte of the tree's root.
+	*/
+	uint8_t run(const uint64_t*);
+	/*
+	Evaluate this tree program over a block of the leaf bank's outputs, each
+	instruction combining whole blocks of its operands at once.
+	Parameter: const uint8_t* outputs - The leaf bank's output rows from
+	LeafBank::stepBlock.
+	Parameter: uint8_t* block - The block to fill with the root's output bytes.
+	Parameter: size_t length - The number of bytes in the block.
+	*/
+	void runBlock(const uint8_t*, uint8_t*, size_t);
+	/*
+	Check whether this tree program holds a compiled tree.
+	Returns: bool - Whether a tree has been compiled.
+	*/
+	bool isCompiled() const;
+	/*
+	Get the instructions of this tree program.
+	Returns: const std::vector<Instruction>& - The instructions, children first.
+	*/
+	const std::vector<Instruction>& getInstructions() const;
+	/*
+	Get the number of heap bytes this tree program holds.
+	Returns: size_t - The bytes of the program's instructions and results.
+	*/
+	size_t getHeapBytes() const;
+	/*
+	Get the time this tree program has spent in the instructions of one gate
+	type, collected only when the library is built with JABBERWOCK_PROFILE
+	defined.
+	Parameter: NodeType type - The type of gate to get the time of.
+	Returns: uint64_t - The time in nanoseconds since the last resetProfile;
+	0 for GLFSRs, which the program does not step.
+	*/
+	uint64_t getNanoseconds(NodeType) const;
+	/*
+	Zero the times this tree program has collected.
+	*/
+	void resetProfile();
+	/*
+	Write this tree program's instructions to a snapshot.
+	Parameter: std::ostream& output - The stream to write to.
+	*/
+	void save(std::ostream&) const;
+	/*
+	Replace this tree program with one read from a snapshot.
+	Parameter: std::istream& input - The stream to read from.
+	Parameter: const LeafBank& bank - The leaf bank which the program loads
+	its gate outputs from.
+	Returns: bool - Whether a valid tree program was read; on failure this tree
+	program is left cleared.
+	*/
+	bool load(std::istream&, const LeafBank&);
+	/*
+	Free this tree program's memory.
+	*/
+	void clear();
+
+private:
+	// The instructions of the program, children before their parents.
+	std::vector<Instruction> m_instructions;
+	// The result of each instruction from the last run.
+	std::vector<uint8_t> m_results;
+	// The block of results of each instruction from the last block run, one
+	// row per instruction.
+	std::vector<uint8_t> m_blockResults;
+	// The time spent in the instructions of each gate type, in nanoseconds,
+	// indexed by NodeType.
+	uint64_t m_nanoseconds[3] = { 0, 0, 0, };
+};
+
+#endif
@@ -9,9 +9,19 @@ Purpose:	Declare miscellaneous utility functions for the Jabberwock PRNG
 #ifndef JABBERWOCK_UTILITIES_H
 #define JABBERWOCK_UTILITIES_H
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+// The SIMD instruction sets which the Jabberwock PRNG library can dispatch to,
+// in increasing order of width.
+enum class InstructionSet : uint8_t {
+	SCALAR,
+	SSE2,
+	AVX2,
+};
+
 // The set of hex symbols for converting between hex and binary.
 const std::string HEX_CHARACTERS = "0123456789abcdef";
 // A set of 16 permutations of 4 objects.
@@ -66,10 +76,67 @@ string.
 */
 extern std::vector<bool> SHA512Binary(const std::string&);
 /*
+Get the length of the permutation of a string; strings are padded with the
+hex characters of their hash to the next multiple of 8 characters, by at least
+one character.
+Parameter: size_t length - The length of the string.
+Returns: size_t - The length of the permuted string.
+*/
+extern size_t permutedLength(size_t);
+/*
+Permute an input string by its SHA-512 hash into a buffer, without allocating
+memory.
+Parameter: const char* input - The characters of the input string.
+Parameter: size_t length - The length of the input string.
+Parameter: char* output - The buffer to write the permuted string to, with room
+for permutedLength(length) characters; may be the input buffer itself.
+Returns: size_t - The length of the permuted string.
+*/
+extern size_t permuteString(const char*, size_t, char*);
+/*
 Permute an input string by its SHA-512 hash.
 Parameter: const std::string& input - The input string.
 Returns: std::string - The permuted string.
 */
 extern std::string permuteString(const std::string&);
+/*
+Detect the widest SIMD instruction set supported by the processor and operating
+system at runtime.
+Returns: InstructionSet - The widest supported instruction set.
+*/
+extern InstructionSet detectInstructionSet();
+
+/*
+A timer over a scope of the Jabberwock PRNG's generation, which adds the
+nanoseconds from its construction to its destruction to a counter. Only used
+through JABBERWOCK_PROFILE_SCOPE.
+*/
+class ProfileTimer {
+public:
+	/*
+	Start timing.
+	Parameter: uint64_t& counter - The counter to add the elapsed time to.
+	*/
+	ProfileTimer(uint64_t&);
+	/*
+	Stop timing and add the elapsed time to the counter.
+	*/
+	~ProfileTimer();
+
+private:
+	// The counter to add the elapsed time to, in nanoseconds.
+	uint64_t& m_counter;
+	// The time the timer was started.
+	std::chrono::steady_clock::time_point m_start;
+};
+
+// Time the rest of the enclosing scope into a counter of nanoseconds when the
+// library is built with JABBERWOCK_PROFILE defined; otherwise, and by default,
+// the timing compiles to nothing.
+#if defined(JABBERWOCK_PROFILE)
+#define JABBERWOCK_PROFILE_SCOPE(counter) ProfileTimer profileTimer(counter)
+#else
+#define JABBERWOCK_PROFILE_SCOPE(counter)
+#endif
 
 #endif
\ No newline at end of file
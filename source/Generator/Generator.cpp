@@ -6,17 +6,339 @@ Purpose:	Implement the main entry point to the Generator program for the
 			Jabberwock PRNG.
 */
 
+#include <Jabberwock/AsyncWriter.h>
+#include <Jabberwock/FormatPipeline.h>
 #include <Jabberwock/Jabberwock.h>
+#include <Jabberwock/PackedFormat.h>
+#include <Jabberwock/Sampler.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <bitset>
+#include <charconv>
+#include <chrono>
+#include <cerrno>
+#include <climits>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#if defined(_MSC_VER)
+#include <fcntl.h>
+#include <io.h>
+#endif
 
 // Implement Generator module functions.
 
 // The set of standard printable characters.
 const static std::string CHARACTERS = "abcdefghijklmnopqrstuvwxyz`1234567890-=["
 	"]\\;',./ABCDEFGHIJKLMNOPQRSTUVWXYZ~!@#$%^&*()_+{}|:\"<>?";
+// The number of bytes to generate from the Jabberwock PRNG at once.
+const static size_t BUFFER_LENGTH = 1 << 16;
+// The name of the class in generated C++ source if none is given.
+const static std::string DEFAULT_CLASS_NAME = "JabberwockGenerator";
+// The most characters an int formats to.
+const static size_t INTEGER_TEXT_LENGTH = 11;
+// The most characters a float formats to with FLOAT_TEXT_PRECISION digits.
+const static size_t FLOAT_TEXT_LENGTH = 16;
+// The significant digits of formatted floats, an ostream's default precision.
+const static int FLOAT_TEXT_PRECISION = 6;
+// The time between progress reports when streaming.
+const static std::chrono::milliseconds PROGRESS_INTERVAL(500);
+// The usage of the non-interactive command line.
+const static std::string USAGE = "Usage: Generator [--buffer <bytes>] "
+	"[--sync <never|close|buffer>] [--range <minimum>\n\t<maximum>] [--npy] "
+	"<seed> <level count> <count>\n\t<binary|bits|int32|int64|float32|float64>"
+	" [output file]\n"
+	"The count is of bytes for binary and bits output, and of elements for the "
+	"packed\nlittle-endian numeric types, which span their whole type or "
+	"[0, 1) unless a range\nis given and are prefixed with a .npy header with "
+	"--npy. A count of 0 streams\nuntil the output is closed, and without an "
+	"output file the stream is written to\nstandard output. Output is written "
+	"from two buffers of 1MiB by default, and\nsynced to the device as the "
+	"sync policy gives.";
+// The names of the sync policies on the command line.
+const static std::vector<std::string> SYNC_POLICY_NAMES = {
+	"never",
+	"close",
+	"buffer",
+};
+
+/*
+Report the progress of a stream, at most once per progress interval.
+Parameter: std::ostream& output - The stream to report to.
+Parameter: uint64_t written - The number of bytes written so far.
+Parameter: uint64_t total - The number of bytes to write, or 0 if unbounded.
+Parameter: std::chrono::steady_clock::time_point start - When the stream
+started.
+Parameter: std::chrono::steady_clock::time_point& nextReport - When the next
+report is due, which is moved on after each report.
+*/
+void reportProgress(std::ostream& output, uint64_t written, uint64_t total,
+	std::chrono::steady_clock::time_point start,
+	std::chrono::steady_clock::time_point& nextReport) {
+	std::chrono::steady_clock::time_point now
+		= std::chrono::steady_clock::now();
+	if (now < nextReport) {
+		return;
+	}
+	nextReport = now + PROGRESS_INTERVAL;
+	double seconds = std::chrono::duration<double>(now - start).count();
+	output << "\r" << written << "B";
+	if (total != 0) {
+		output << " (" << written * 100 / total << "%)";
+	}
+	output << ", " << written / seconds / 1e6 << "MB/s   " << std::flush;
+}
+
+/*
+Report the end of a stream.
+Parameter: std::ostream& output - The stream to report to.
+Parameter: uint64_t written - The number of bytes written.
+Parameter: std::chrono::steady_clock::time_point start - When the stream
+started.
+*/
+void reportCompletion(std::ostream& output, uint64_t written,
+	std::chrono::steady_clock::time_point start) {
+	double seconds = std::chrono::duration<double>(
+		std::chrono::steady_clock::now() - start).count();
+	output << "\r" << written << "B in " << seconds << "s, "
+		<< written / seconds / 1e6 << "MB/s   " << std::endl;
+}
+
+/*
+Print the number of PRNG bytes a sampler consumed.
+Parameter: std::ostream& output - The stream to print to.
+Parameter: const Sampler& sampler - The sampler the symbols were drawn with.
+Parameter: uint64_t outputSymbolCount - The number of symbols drawn.
+*/
+void reportConsumption(std::ostream& output, const Sampler& sampler,
+	uint64_t outputSymbolCount) {
+	output << std::endl << "Consumed " << sampler.getConsumedBytes()
+		<< "B of keystream, " << (double)sampler.getConsumedBytes()
+		/ outputSymbolCount << "B per symbol" << std::endl;
+}
+
+/*
+Stream bytes from the Jabberwock PRNG to an asynchronous writer a buffer at a
+time, reporting progress to the error stream on a timer, so that the output may
+be piped into other programs at the PRNG's full speed.
+Parameter: Jabberwock& jabberwock - The Jabberwock PRNG.
+Parameter: uint64_t byteCount - The number of bytes to generate, or 0 to
+generate until the output can no longer be written.
+Parameter: AsyncWriter& writer - The open writer to write to.
+Parameter: bool bits - Whether to write each byte as text of its 8 bits rather
+than as a raw byte.
+Returns: bool - Whether every byte was written.
+*/
+bool streamBinary(Jabberwock& jabberwock, uint64_t byteCount,
+	AsyncWriter& writer, bool bits) {
+	size_t bufferLength = bits ? std::max(writer.getBufferLength() / 8,
+		(size_t)1) : writer.getBufferLength();
+	std::vector<uint8_t> buffer(bits ? bufferLength : 0);
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point nextReport
+		= start + PROGRESS_INTERVAL;
+	uint64_t written = 0;
+	bool success = true;
+	while (success && (byteCount == 0 || written < byteCount)) {
+		size_t length = byteCount == 0 ? bufferLength
+			: (size_t)std::min((uint64_t)bufferLength, byteCount - written);
+		if (bits) {
+			jabberwock.generate(buffer.data(), length);
+			char text[8];
+			for (size_t i = 0; i < length && success; i++) {
+				for (size_t j = 0; j < 8; j++) {
+					text[j] = (buffer[i] >> (7 - j)) & 1 ? '1' : '0';
+				}
+				success &= writer.write(text, 8);
+			}
+		}
+		else {
+			jabberwock.generate(writer.getBuffer(), length);
+			success &= writer.submit(length);
+		}
+		written += length;
+		reportProgress(std::cerr, written, byteCount, start, nextReport);
+	}
+	success &= writer.close();
+	reportCompletion(std::cerr, writer.getWrittenBytes(), start);
+	return success;
+}
+
+/*
+Stream packed little-endian numbers drawn from the Jabberwock PRNG to an
+asynchronous writer, in blocks of the writer's buffer length, reporting
+progress on a timer.
+Parameter: Jabberwock& jabberwock - The Jabberwock PRNG.
+Parameter: uint64_t elementCount - The number of elements to generate, or 0 to
+generate until the output can no longer be written.
+Parameter: AsyncWriter& writer - The open writer to write to.
+Parameter: const PackedFormat& format - The format of the elements.
+Parameter: std::ostream& output - The stream to report progress to.
+Returns: bool - Whether every element was written.
+*/
+bool streamPacked(Jabberwock& jabberwock, uint64_t elementCount,
+	AsyncWriter& writer, const PackedFormat& format, std::ostream& output) {
+	bool success = true;
+	if (format.npy) {
+		std::string header = npyHeader(format, elementCount);
+		success &= writer.write(header.data(), header.length());
+	}
+	size_t elementSize = ELEMENT_SIZES[(size_t)format.type];
+	size_t blockCount = std::max(writer.getBufferLength() / elementSize,
+		(size_t)1);
+	std::vector<uint8_t> block(blockCount * elementSize);
+	Sampler sampler(&jabberwock);
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	std::chrono::steady_clock::time_point nextReport
+		= start + PROGRESS_INTERVAL;
+	uint64_t written = 0;
+	while (success && (elementCount == 0 || written < elementCount)) {
+		size_t count = elementCount == 0 ? blockCount
+			: (size_t)std::min((uint64_t)blockCount, elementCount - written);
+		drawPacked(sampler, format, block.data(), count);
+		success &= writer.write(block.data(), count * elementSize);
+		written += count;
+		reportProgress(output, written * elementSize,
+			elementCount * elementSize, start, nextReport);
+	}
+	success &= writer.close();
+	reportCompletion(output, writer.getWrittenBytes(), start);
+	reportConsumption(output, sampler, written);
+	return success;
+}
+
+/*
+Run the Generator program without prompts, taking its options from the command
+line.
+Parameter: int argc - The number of command line arguments to the program.
+Parameter: char** argv - The command line arguments to the program.
+Returns: int - The exit code of the program.
+*/
+int runCommandLine(int argc, char** argv) {
+	size_t bufferLength = ASYNC_WRITER_BUFFER_LENGTH;
+	SyncPolicy syncPolicy = SyncPolicy::NEVER;
+	PackedFormat format = {};
+	std::string rangeMinimum = "";
+	std::string rangeMaximum = "";
+	std::vector<std::string> arguments;
+	char* end = nullptr;
+	for (int i = 1; i < argc; i++) {
+		std::string argument = argv[i];
+		int valueCount = argument == "--range" ? 2 : argument == "--buffer"
+			|| argument == "--sync" ? 1 : 0;
+		if (i + valueCount >= argc) {
+			std::cerr << "Missing value for " << argument << std::endl;
+			return EXIT_FAILURE;
+		}
+		if (argument == "--buffer") {
+			errno = 0;
+			bufferLength = (size_t)std::strtoull(argv[++i], &end, 10);
+			if (*end != '\0' || errno == ERANGE || bufferLength == 0) {
+				std::cerr << "Invalid buffer length" << std::endl;
+				return EXIT_FAILURE;
+			}
+		}
+		else if (argument == "--sync") {
+			std::vector<std::string>::const_iterator name = std::find(
+				SYNC_POLICY_NAMES.begin(), SYNC_POLICY_NAMES.end(), argv[++i]);
+			if (name == SYNC_POLICY_NAMES.end()) {
+				std::cerr << "Invalid sync policy" << std::endl;
+				return EXIT_FAILURE;
+			}
+			syncPolicy = (SyncPolicy)(name - SYNC_POLICY_NAMES.begin());
+		}
+		else if (argument == "--range") {
+			rangeMinimum = argv[++i];
+			rangeMaximum = argv[++i];
+		}
+		else if (argument == "--npy") {
+			format.npy = true;
+		}
+		else {
+			arguments.push_back(argument);
+		}
+	}
+	if (arguments.size() < 4 || arguments.size() > 5) {
+		std::cerr << USAGE << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::string seed = arguments[0];
+	unsigned long long levelCount = std::strtoull(arguments[1].c_str(), &end,
+		10);
+	if (*end != '\0' || levelCount <= 2 || levelCount > UINT_MAX) {
+		std::cerr << "Invalid level count" << std::endl;
+		return EXIT_FAILURE;
+	}
+	errno = 0;
+	uint64_t count = std::strtoull(arguments[2].c_str(), &end, 10);
+	if (*end != '\0' || errno == ERANGE || arguments[2].empty()
+		|| arguments[2][0] == '-') {
+		std::cerr << "Invalid count" << std::endl;
+		return EXIT_FAILURE;
+	}
+	std::string outputType = arguments[3];
+	std::vector<std::string>::const_iterator elementType = std::find(
+		ELEMENT_TYPE_NAMES.begin(), ELEMENT_TYPE_NAMES.end(), outputType);
+	bool packed = elementType != ELEMENT_TYPE_NAMES.end();
+	if (!packed && outputType != "binary" && outputType != "bits") {
+		std::cerr << "Invalid output type" << std::endl;
+		return EXIT_FAILURE;
+	}
+	if (packed) {
+		format.type = (ElementType)(elementType - ELEMENT_TYPE_NAMES.begin());
+		if (!parsePackedRange(format, rangeMinimum, rangeMaximum)) {
+			std::cerr << "Invalid range" << std::endl;
+			return EXIT_FAILURE;
+		}
+		// A .npy header gives the element count up front.
+		if (format.npy && count == 0) {
+			std::cerr << "A .npy stream needs a count" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	AsyncWriter writer;
+	if (arguments.size() == 5) {
+		if (!writer.open(arguments[4], bufferLength, syncPolicy)) {
+			std::cerr << "Invalid output file name" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+	else {
+#if defined(_MSC_VER)
+		_setmode(_fileno(stdout), _O_BINARY);
+#endif
+		if (!writer.open(stdout, bufferLength, syncPolicy)) {
+			std::cerr << "Invalid standard output" << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+#if !defined(_MSC_VER)
+	// A reader closing the output fails the next write with EPIPE instead of
+	// killing the program, so the stream can end and report cleanly.
+	std::signal(SIGPIPE, SIG_IGN);
+#endif
+	Jabberwock jabberwock;
+	jabberwock.setThreadCount(std::thread::hardware_concurrency());
+	jabberwock.seed(seed, (unsigned int)levelCount);
+	bool success = packed
+		? streamPacked(jabberwock, count, writer, format, std::cerr)
+		: streamBinary(jabberwock, count, writer, outputType == "bits");
+	jabberwock.clear();
+	// An unbounded stream ends when its reader closes the output; any other
+	// failure to write is an error.
+	if (!success && (count != 0 || writer.getError() != EPIPE)) {
+		std::cerr << "Writing the output failed" << std::endl;
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
 
 /*
 Generate binary data with the Jabberwock PRNG and write it to a file or the
@@ -24,23 +346,34 @@ console.
 Parameter: Jabberwock& jabberwock - The Jabberwock PRNG.
 Parameter: size_t outputSymbolCount - The number of bytes to generate.
 Parameter: const std::string& outputFileName - The file name to write to.
+Returns: bool - Whether every byte was written.
 */
-void generateBinary(Jabberwock& jabberwock, size_t outputSymbolCount,
+bool generateBinary(Jabberwock& jabberwock, size_t outputSymbolCount,
 	const std::string& outputFileName) {
-	std::ofstream outputFile;
-	if (!outputFileName.empty()) {
-		outputFile.open(outputFileName, std::ios::binary);
+	AsyncWriter writer;
+	if (!outputFileName.empty() && !writer.open(outputFileName,
+		ASYNC_WRITER_BUFFER_LENGTH, SyncPolicy::NEVER)) {
+		return false;
 	}
 	bool progress[10];
 	for (size_t i = 0; i < 10; i++) {
 		progress[i] = false;
 	}
-	for (size_t i = 0; i < outputSymbolCount; i++) {
-		uint8_t byte = jabberwock.generate();
+	std::vector<uint8_t> buffer(BUFFER_LENGTH);
+	size_t bufferLength = outputFileName.empty() ? BUFFER_LENGTH
+		: writer.getBufferLength();
+	for (size_t i = 0; i < outputSymbolCount; i += bufferLength) {
+		size_t length = std::min(bufferLength, outputSymbolCount - i);
 		if (!outputFileName.empty()) {
-			outputFile.write((const char*)(&byte), 1);
+			// Each buffer is generated while the last is written to the file.
+			jabberwock.generate(writer.getBuffer(), length);
+			if (!writer.submit(length)) {
+				writer.close();
+				return false;
+			}
+			size_t last = i + length - 1;
 			for (size_t j = 0; j < 10; j++) {
-				if ((float)i / (float)outputSymbolCount > (float)j / 10.0f
+				if ((float)last / (float)outputSymbolCount > (float)j / 10.0f
 					&& !progress[j]) {
 					progress[j] = true;
 					std::cout << (j * 10.0f) << "%, ";
@@ -48,9 +381,86 @@ void generateBinary(Jabberwock& jabberwock, size_t outputSymbolCount,
 			}
 		}
 		else {
-			std::cout << std::bitset<8>(byte);
+			jabberwock.generate(buffer.data(), length);
+			for (size_t j = 0; j < length; j++) {
+				std::cout << std::bitset<8>(buffer[j]);
+			}
 		}
 	}
+	return outputFileName.empty() || writer.close();
+}
+
+/*
+Draw symbols, format them as text and write them to a file through a format
+pipeline over every hardware thread, printing the progress to the console. The
+text is the same as formatting the symbols one by one to the console.
+Template: typename T - The type of the symbols.
+Template: typename Draw - The type of the draw function.
+Template: typename Format - The type of the format function.
+Parameter: uint64_t outputSymbolCount - The number of symbols to write.
+Parameter: const std::string& outputFileName - The file name to write to.
+Parameter: size_t maximumLength - The most characters a symbol formats to.
+Parameter: Draw draw - Draws each symbol in order.
+Parameter: Format format - Writes a symbol's text and returns the end of it.
+Returns: bool - Whether every symbol was written.
+*/
+template <typename T, typename Draw, typename Format>
+bool formatToFile(uint64_t outputSymbolCount,
+	const std::string& outputFileName, size_t maximumLength, Draw draw,
+	Format format) {
+	AsyncWriter writer;
+	if (!writer.open(outputFileName, ASYNC_WRITER_BUFFER_LENGTH,
+		SyncPolicy::NEVER)) {
+		return false;
+	}
+	bool progress[10];
+	for (size_t i = 0; i < 10; i++) {
+		progress[i] = false;
+	}
+	FormatPipeline pipeline;
+	pipeline.start(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+	bool success = pipeline.run<T>(outputSymbolCount, maximumLength, writer,
+		draw, format, [&progress, outputSymbolCount](uint64_t written) {
+		for (size_t j = 0; j < 10; j++) {
+			if ((float)written / (float)outputSymbolCount > (float)j / 10.0f
+				&& !progress[j]) {
+				progress[j] = true;
+				std::cout << (j * 10.0f) << "%, ";
+			}
+		}
+	});
+	pipeline.stop();
+	return writer.close() && success;
+}
+
+/*
+Format an integer as text followed by a separator.
+Parameter: char* output - The buffer to write to, with at least
+INTEGER_TEXT_LENGTH characters free.
+Parameter: int integer - The integer to format.
+Returns: char* - The end of the text.
+*/
+char* formatInteger(char* output, int integer) {
+	output = std::to_chars(output, output + INTEGER_TEXT_LENGTH, integer).ptr;
+	*output++ = ',';
+	*output++ = ' ';
+	return output;
+}
+
+/*
+Format a float as text followed by a separator, in the general notation with 6
+significant digits which an ostream prints floats in by default.
+Parameter: char* output - The buffer to write to, with at least
+FLOAT_TEXT_LENGTH characters free.
+Parameter: float flt - The float to format.
+Returns: char* - The end of the text.
+*/
+char* formatFloat(char* output, float flt) {
+	output = std::to_chars(output, output + FLOAT_TEXT_LENGTH, (double)flt,
+		std::chars_format::general, FLOAT_TEXT_PRECISION).ptr;
+	*output++ = ',';
+	*output++ = ' ';
+	return output;
 }
 
 /*
@@ -61,40 +471,30 @@ Parameter: size_t outputSymbolCount - The number of characters to generate.
 Parameter: const std::string& outputFileName - The file name to write to.
 Parameter: const std::string& allowedCharacters - The set of characters to
 choose from when generating data.
+Returns: bool - Whether every character was written.
 */
-void generateText(Jabberwock& jabberwock, size_t outputSymbolCount,
+bool generateText(Jabberwock& jabberwock, size_t outputSymbolCount,
 	const std::string& outputFileName, const std::string& allowedCharacters) {
-	std::ofstream outputFile;
+	Sampler sampler(&jabberwock);
+	bool success = true;
 	if (!outputFileName.empty()) {
-		outputFile.open(outputFileName);
+		success = formatToFile<char>(outputSymbolCount, outputFileName, 1,
+			[&sampler, &allowedCharacters]() {
+			return allowedCharacters[
+				sampler.nextIndex(allowedCharacters.length())];
+		}, [](char* output, char character) {
+			*output = character;
+			return output + 1;
+		});
 	}
-	bool progress[10];
-	for (size_t i = 0; i < 10; i++) {
-		progress[i] = false;
-	}
-	for (size_t i = 0; i < outputSymbolCount; i++) {
-		unsigned int selector = 0x00000000;
-		for (size_t j = 0; j < 4; j++) {
-			uint8_t byte = jabberwock.generate();
-			selector <<= 8;
-			selector |= (unsigned int)byte;
-		}
-		char character = allowedCharacters[
-			selector % allowedCharacters.length()];
-		if (!outputFileName.empty()) {
-			outputFile << character;
-			for (size_t j = 0; j < 10; j++) {
-				if ((float)i / (float)outputSymbolCount > (float)j / 10.0f
-					&& !progress[j]) {
-					progress[j] = true;
-					std::cout << (j * 10.0f) << "%, ";
-				}
-			}
-		}
-		else {
-			std::cout << character;
+	else {
+		for (size_t i = 0; i < outputSymbolCount; i++) {
+			std::cout << allowedCharacters[
+				sampler.nextIndex(allowedCharacters.length())];
 		}
 	}
+	reportConsumption(std::cout, sampler, outputSymbolCount);
+	return success;
 }
 
 /*
@@ -105,40 +505,25 @@ Parameter: size_t outputSymbolCount - The number of integers to generate.
 Parameter: const std::string& outputFileName - The file name to write to.
 Parameter: int minimum - The minimum output value to generate.
 Parameter: int maximum - The maximum output value to generate.
+Returns: bool - Whether every integer was written.
 */
-void generateIntegers(Jabberwock& jabberwock, size_t outputSymbolCount,
+bool generateIntegers(Jabberwock& jabberwock, size_t outputSymbolCount,
 	const std::string& outputFileName, int minimum, int maximum) {
-	std::ofstream outputFile;
+	Sampler sampler(&jabberwock);
+	bool success = true;
 	if (!outputFileName.empty()) {
-		outputFile.open(outputFileName);
+		success = formatToFile<int>(outputSymbolCount, outputFileName,
+			INTEGER_TEXT_LENGTH + 2, [&sampler, minimum, maximum]() {
+			return (int)sampler.nextInRange(minimum, maximum);
+		}, formatInteger);
 	}
-	bool progress[10];
-	for (size_t i = 0; i < 10; i++) {
-		progress[i] = false;
-	}
-	for (size_t i = 0; i < outputSymbolCount; i++) {
-		unsigned int selector = 0x00000000;
-		for (size_t j = 0; j < 4; j++) {
-			uint8_t byte = jabberwock.generate();
-			selector <<= 8;
-			selector |= (unsigned int)byte;
-		}
-		int range = maximum - minimum;
-		int integer = minimum + (selector % (range + 1));
-		if (!outputFileName.empty()) {
-			outputFile << integer << ", ";
-			for (size_t j = 0; j < 10; j++) {
-				if ((float)i / (float)outputSymbolCount > (float)j / 10.0f
-					&& !progress[j]) {
-					progress[j] = true;
-					std::cout << (j * 10.0f) << "%, ";
-				}
-			}
-		}
-		else {
-			std::cout << integer << ", ";
+	else {
+		for (size_t i = 0; i < outputSymbolCount; i++) {
+			std::cout << (int)sampler.nextInRange(minimum, maximum) << ", ";
 		}
 	}
+	reportConsumption(std::cout, sampler, outputSymbolCount);
+	return success;
 }
 
 /*
@@ -146,49 +531,55 @@ Generate floats with the Jabberwock PRNG and write it to a file or the console.
 Parameter: Jabberwock& jabberwock - The Jabberwock PRNG.
 Parameter: size_t outputSymbolCount - The number of floats to generate.
 Parameter: const std::string& outputFileName - The file name to write to.
+Returns: bool - Whether every float was written.
 */
-void generateFloats(Jabberwock& jabberwock, size_t outputSymbolCount,
+bool generateFloats(Jabberwock& jabberwock, size_t outputSymbolCount,
 	const std::string& outputFileName, float minimum, float maximum) {
-	std::ofstream outputFile;
+	Sampler sampler(&jabberwock);
+	bool success = true;
 	if (!outputFileName.empty()) {
-		outputFile.open(outputFileName);
-	}
-	bool progress[10];
-	for (size_t i = 0; i < 10; i++) {
-		progress[i] = false;
+		success = formatToFile<float>(outputSymbolCount, outputFileName,
+			FLOAT_TEXT_LENGTH + 2, [&sampler, minimum, maximum]() {
+			return sampler.nextFloat(minimum, maximum);
+		}, formatFloat);
 	}
-	for (size_t i = 0; i < outputSymbolCount; i++) {
-		unsigned int selector = 0x00000000;
-		for (size_t j = 0; j < 4; j++) {
-			uint8_t byte = jabberwock.generate();
-			selector <<= 8;
-			selector |= (unsigned int)byte;
-		}
-		float range = maximum - minimum;
-		float flt = minimum + (range * ((float)selector / (float)UINT_MAX));
-		if (!outputFileName.empty()) {
-			outputFile << flt << ", ";
-			for (size_t j = 0; j < 10; j++) {
-				if ((float)i / (float)outputSymbolCount > (float)j / 10.0f
-					&& !progress[j]) {
-					progress[j] = true;
-					std::cout << (j * 10.0f) << "%, ";
-				}
-			}
-		}
-		else {
-			std::cout << flt << ", ";
+	else {
+		for (size_t i = 0; i < outputSymbolCount; i++) {
+			std::cout << sampler.nextFloat(minimum, maximum) << ", ";
 		}
 	}
+	reportConsumption(std::cout, sampler, outputSymbolCount);
+	return success;
+}
+
+/*
+Write the seeded Jabberwock PRNG's tree out as a C++ header to a file or the
+console.
+Parameter: const Jabberwock& jabberwock - The Jabberwock PRNG.
+Parameter: const std::string& outputFileName - The file name to write to.
+Parameter: const std::string& className - The name of the generated class.
+Returns: bool - Whether the header was written.
+*/
+bool generateSource(const Jabberwock& jabberwock,
+	const std::string& outputFileName, const std::string& className) {
+	if (outputFileName.empty()) {
+		return jabberwock.emitSource(std::cout, className);
+	}
+	std::ofstream outputFile(outputFileName);
+	return jabberwock.emitSource(outputFile, className);
 }
 
 /*
-The main entry point to the Generator program.
+The main entry point to the Generator program, which prompts for its options
+unless they are given on the command line.
 Parameter: int argc - The number of command line arguments to the program.
 Parameter: char** argv - The command line arguments to the program.
 Returns: int - The exit code of the program.
 */
 int main(int argc, char** argv) {
+	if (argc > 1) {
+		return runCommandLine(argc, argv);
+	}
 	srand((unsigned int)time(0));
 	std::cout << "Jabberwock PRNG Generator" << std::endl << std::endl;
 	std::cout << "Seed: ";
@@ -263,7 +654,8 @@ int main(int argc, char** argv) {
 	outputFileTest.close();
 	std::cout << std::endl << "Output types:" << std::endl << "1. Binary"
 		<< std::endl << "2. Text" << std::endl << "3. Integers" << std::endl
-		<< "4. Floats" << std::endl << "Option: ";
+		<< "4. Floats" << std::endl << "5. C++ source" << std::endl
+		<< "6. Packed numbers" << std::endl << "Option: ";
 	std::string outputTypeStr = "";
 	if (!std::getline(std::cin, outputTypeStr)) {
 		std::cout << "Invalid input" << std::endl;
@@ -271,7 +663,7 @@ int main(int argc, char** argv) {
 		return EXIT_FAILURE;
 	}
 	int outputType = std::atoi(outputTypeStr.c_str());
-	if (outputType <= 0 || outputType >= 5) {
+	if (outputType <= 0 || outputType >= 7) {
 		std::cout << "Invalid output type" << std::endl;
 		jabberwock.clear();
 		return EXIT_FAILURE;
@@ -279,7 +671,11 @@ int main(int argc, char** argv) {
 	if (outputType == 1) {
 		std::cout << std::endl << "Generating binary..." << std::endl
 			<< std::endl;
-		generateBinary(jabberwock, outputSymbolCount, outputFileName);
+		if (!generateBinary(jabberwock, outputSymbolCount, outputFileName)) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 	}
 	else if (outputType == 2) {
 		std::cout << std::endl << "Allowed characters: ";
@@ -296,8 +692,12 @@ int main(int argc, char** argv) {
 		}
 		std::cout << std::endl << "Generating text..." << std::endl
 			<< std::endl;
-		generateText(jabberwock, outputSymbolCount, outputFileName,
-			allowedCharacters);
+		if (!generateText(jabberwock, outputSymbolCount, outputFileName,
+			allowedCharacters)) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 	}
 	else if (outputType == 3) {
 		std::cout << std::endl << "Minimum value: ";
@@ -324,8 +724,12 @@ int main(int argc, char** argv) {
 		}
 		std::cout << "Using maximum value " << maximum << std::endl
 			<< std::endl;
-		generateIntegers(jabberwock, outputSymbolCount, outputFileName,
-			minimum, maximum);
+		if (!generateIntegers(jabberwock, outputSymbolCount, outputFileName,
+			minimum, maximum)) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 	}
 	else if (outputType == 4) {
 		std::cout << std::endl << "Minimum value: ";
@@ -336,6 +740,11 @@ int main(int argc, char** argv) {
 			return EXIT_FAILURE;
 		}
 		float minimum = (float)std::atof(minimumStr.c_str());
+		if (!std::isfinite(minimum)) {
+			std::cout << "Invalid minimum value" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 		std::cout << "Using minimum value " << minimum << std::endl
 			<< "Maximum value: ";
 		std::string maximumStr = "";
@@ -345,15 +754,113 @@ int main(int argc, char** argv) {
 			return EXIT_FAILURE;
 		}
 		float maximum = (float)std::atof(maximumStr.c_str());
-		if (maximum <= minimum) {
+		if (!std::isfinite(maximum) || maximum <= minimum) {
 			std::cout << "Invalid maximum value" << std::endl;
 			jabberwock.clear();
 			return EXIT_FAILURE;
 		}
 		std::cout << "Using maximum value " << maximum << std::endl
 			<< std::endl;
-		generateFloats(jabberwock, outputSymbolCount, outputFileName,
-			minimum, maximum);
+		if (!generateFloats(jabberwock, outputSymbolCount, outputFileName,
+			minimum, maximum)) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+	}
+	else if (outputType == 5) {
+		std::cout << std::endl << "Class name: ";
+		std::string className = "";
+		if (!std::getline(std::cin, className)) {
+			std::cout << "Invalid input" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		if (className.empty()) {
+			className = DEFAULT_CLASS_NAME;
+			std::cout << "Using default class name \"" << className << "\""
+				<< std::endl;
+		}
+		std::cout << std::endl << "Generating C++ source..." << std::endl
+			<< std::endl;
+		if (!generateSource(jabberwock, outputFileName, className)) {
+			std::cout << "Invalid class name" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+	}
+	else if (outputType == 6) {
+		if (outputFileName.empty()) {
+			std::cout << "Packed numbers need an output file" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		std::cout << std::endl << "Element type (int32, int64, float32, "
+			<< "float64): ";
+		std::string elementTypeStr = "";
+		if (!std::getline(std::cin, elementTypeStr)) {
+			std::cout << "Invalid input" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		std::vector<std::string>::const_iterator elementType = std::find(
+			ELEMENT_TYPE_NAMES.begin(), ELEMENT_TYPE_NAMES.end(),
+			elementTypeStr);
+		if (elementType == ELEMENT_TYPE_NAMES.end()) {
+			std::cout << "Invalid element type" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		PackedFormat format = {};
+		format.type = (ElementType)(elementType - ELEMENT_TYPE_NAMES.begin());
+		std::cout << "Minimum value: ";
+		std::string minimumStr = "";
+		std::string maximumStr = "";
+		if (!std::getline(std::cin, minimumStr)) {
+			std::cout << "Invalid input" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		if (!minimumStr.empty()) {
+			std::cout << "Maximum value: ";
+			if (!std::getline(std::cin, maximumStr)) {
+				std::cout << "Invalid input" << std::endl;
+				jabberwock.clear();
+				return EXIT_FAILURE;
+			}
+		}
+		if (!parsePackedRange(format, minimumStr, maximumStr)) {
+			std::cout << "Invalid range" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		if (minimumStr.empty()) {
+			std::cout << "Using default range of the element type"
+				<< std::endl;
+		}
+		std::cout << "Write .npy header (y/n): ";
+		std::string npyStr = "";
+		if (!std::getline(std::cin, npyStr)) {
+			std::cout << "Invalid input" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		format.npy = npyStr == "y" || npyStr == "Y";
+		std::cout << std::endl << "Generating packed numbers..." << std::endl
+			<< std::endl;
+		AsyncWriter writer;
+		if (!writer.open(outputFileName, ASYNC_WRITER_BUFFER_LENGTH,
+			SyncPolicy::NEVER)) {
+			std::cout << "Invalid output file" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
+		if (!streamPacked(jabberwock, outputSymbolCount, writer, format,
+			std::cout)) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 	}
 	jabberwock.clear();
 	std::cout << std::endl << std::endl << "Cleared Jabberwock PRNG"
@@ -0,0 +1,609 @@
+/*
+File:		Benchmark.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@11:40
+Purpose:	Implement the benchmarks found in Benchmark.h.
+*/
+
+#include "Benchmark.h"
+#include "EmittedGenerator.h"
+
+#include <Jabberwock/AsyncWriter.h>
+#include <Jabberwock/FormatPipeline.h>
+#include <Jabberwock/Jabberwock.h>
+#include <Jabberwock/PrefetchBuffer.h>
+#include <Jabberwock/Sampler.h>
+#include <Jabberwock/Utilities.h>
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <variant>
+
+// Implement Benchmark module functions.
+
+// The number of 4-byte chunks to hash in the multi-buffer SHA-512 benchmark.
+const static size_t HASH_BENCHMARK_COUNT = 1 << 16;
+// The names of the instruction sets.
+const static std::vector<std::string> INSTRUCTION_SET_NAMES = {
+	"Scalar",
+	"SSE2",
+	"AVX2",
+};
+// The number of bytes to step each GLFSR by in the jump benchmark.
+const static uint64_t JUMP_BENCHMARK_LENGTH = 1ULL << 20;
+// The number of bytes to jump each GLFSR by in the long jump benchmark.
+const static uint64_t LONG_JUMP_BENCHMARK_LENGTH = 1ULL << 40;
+// The seed of the trees in the tree benchmarks.
+const static std::string BENCHMARK_SEED = "TestSeedData";
+// The number of bytes to generate in the tree benchmarks.
+const static uint64_t TREE_BENCHMARK_LENGTH = 1ULL << 14;
+// The number of bytes to generate and write in the asynchronous writer
+// benchmark.
+const static uint64_t WRITER_BENCHMARK_LENGTH = 1ULL << 22;
+// The number of floats to format in the format pipeline benchmark.
+const static size_t FORMAT_BENCHMARK_COUNT = 1 << 22;
+// The number of bytes to generate in the parallel benchmark.
+const static uint64_t PARALLEL_BENCHMARK_LENGTH = 1ULL << 16;
+// The number of bytes to skip in the seek benchmark.
+const static uint64_t SEEK_BENCHMARK_LENGTH = 1ULL << 20;
+
+/*
+Get the time elapsed since a point in time.
+Parameter: std::chrono::steady_clock::time_point start - The point in time.
+Returns: double - The elapsed time in microseconds.
+*/
+static double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+	return std::chrono::duration<double, std::micro>(
+		std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmarkSeeding() {
+	unsigned int threadCount = std::max(std::thread::hardware_concurrency(),
+		1u);
+	std::cout << "Seeding: 1 thread vs " << threadCount << " threads"
+		<< std::endl;
+	for (unsigned int levelCount = 3; levelCount <= 6; levelCount++) {
+		double times[2] = { 0.0, 0.0, };
+		for (size_t i = 0; i < 2; i++) {
+			Jabberwock jabberwock;
+			jabberwock.setThreadCount(i == 0 ? 1 : threadCount);
+			std::chrono::steady_clock::time_point start
+				= std::chrono::steady_clock::now();
+			jabberwock.seed(BENCHMARK_SEED, levelCount);
+			times[i] = elapsedMicroseconds(start);
+			jabberwock.clear();
+		}
+		std::cout << levelCount << " levels: " << times[0] << "us vs "
+			<< times[1] << "us" << std::endl;
+	}
+}
+
+void benchmarkSHA512Many() {
+	std::cout << "SHA-512 multi-buffer: " << HASH_BENCHMARK_COUNT
+		<< " 4B chunks" << std::endl;
+	std::vector<uint8_t> inputs(HASH_BENCHMARK_COUNT * 4);
+	for (size_t i = 0; i < inputs.size(); i++) {
+		inputs[i] = (uint8_t)HEX_CHARACTERS[(i * 7) % 16];
+	}
+	std::vector<SHA512Digest> digests(HASH_BENCHMARK_COUNT);
+	InstructionSet supported = detectInstructionSet();
+	for (size_t set = 0; set <= (size_t)supported; set++) {
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		SHA512RawMany(inputs.data(), 4, HASH_BENCHMARK_COUNT, digests.data(),
+			(InstructionSet)set);
+		double hashTime = elapsedMicroseconds(start);
+		std::cout << INSTRUCTION_SET_NAMES[set] << ": " << hashTime << "us ("
+			<< hashTime * 1000.0 / HASH_BENCHMARK_COUNT << "ns per chunk)"
+			<< std::endl;
+	}
+}
+
+void benchmarkGLFSRJump() {
+	std::cout << "GLFSR jump: stepping vs jumping " << JUMP_BENCHMARK_LENGTH
+		<< "B, jumping " << LONG_JUMP_BENCHMARK_LENGTH << "B" << std::endl;
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		SHA512Digest stateDigest = SHA512Raw("GLFSR"
+			+ std::to_string(config));
+		GLFSR stepped;
+		stepped.seed(config, stateDigest);
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < JUMP_BENCHMARK_LENGTH; i++) {
+			stepped.generate();
+		}
+		double steppedTime = elapsedMicroseconds(start);
+		GLFSR jumped;
+		jumped.seed(config, stateDigest);
+		start = std::chrono::steady_clock::now();
+		jumped.jump(JUMP_BENCHMARK_LENGTH * 8);
+		double jumpedTime = elapsedMicroseconds(start);
+		start = std::chrono::steady_clock::now();
+		jumped.jump(LONG_JUMP_BENCHMARK_LENGTH * 8);
+		double longJumpedTime = elapsedMicroseconds(start);
+		std::cout << "Configuration " << config << " ("
+			<< GLFSR_CONFIGS[config][0] << " bits): " << steppedTime
+			<< "us vs " << jumpedTime << "us, " << longJumpedTime << "us"
+			<< std::endl;
+	}
+}
+
+void benchmarkFixedGLFSR() {
+	std::cout << "Fixed GLFSR: GLFSR vs fixed GLFSR " << JUMP_BENCHMARK_LENGTH
+		<< "B" << std::endl;
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		SHA512Digest stateDigest = SHA512Raw("GLFSR"
+			+ std::to_string(config));
+		GLFSR glfsr;
+		glfsr.seed(config, stateDigest);
+		// Both GLFSRs produce the same bytes, so their XOR cancels; reading it
+		// keeps either loop from being optimized out.
+		uint8_t checksum = 0;
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < JUMP_BENCHMARK_LENGTH; i++) {
+			checksum ^= glfsr.generate();
+		}
+		double glfsrTime = elapsedMicroseconds(start);
+		FixedGLFSRVariant fixed = makeFixedGLFSR(config);
+		start = std::chrono::steady_clock::now();
+		std::visit([&](auto& fixedGLFSR) {
+			fixedGLFSR.seed(stateDigest);
+			for (uint64_t i = 0; i < JUMP_BENCHMARK_LENGTH; i++) {
+				checksum ^= fixedGLFSR.generate();
+			}
+		}, fixed);
+		double fixedTime = elapsedMicroseconds(start);
+		std::cout << "Configuration " << config << " ("
+			<< GLFSR_CONFIGS[config][0] << " bits): " << glfsrTime
+			<< "us vs " << fixedTime << "us"
+			<< (checksum == 0 ? "" : " (outputs differ)") << std::endl;
+	}
+}
+
+/*
+Measure the memory walked by generating a byte from a banked node tree: each
+gate node and the array of its children's pointers, allocated separately.
+Parameter: const Node& node - The root of the tree.
+Returns: size_t - The number of bytes in the tree's gates and child arrays.
+*/
+static size_t nodeTreeSize(const Node& node) {
+	if (node.isBanked()) {
+		return sizeof(XORNode);
+	}
+	size_t size = sizeof(XORNode) + node.getChildren().size() * sizeof(Node*);
+	for (const Node* child : node.getChildren()) {
+		size += nodeTreeSize(*child);
+	}
+	return size;
+}
+
+void benchmarkTreeProgram() {
+	std::cout << "Tree program: node tree vs tree program, "
+		<< TREE_BENCHMARK_LENGTH << "B" << std::endl;
+	for (unsigned int levelCount = 3; levelCount <= 6; levelCount++) {
+		NodeArena arena;
+		XORNode root(&arena);
+		root.seed(BENCHMARK_SEED, levelCount - 1);
+		LeafBank bank;
+		root.bankLeaves(bank);
+		bank.finalize();
+		size_t treeSize = nodeTreeSize(root);
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+			bank.step();
+			root.generate();
+		}
+		double treeTime = elapsedMicroseconds(start);
+		TreeProgram program;
+		program.compile(root, bank);
+		size_t programSize = program.getInstructions().size()
+			* (sizeof(TreeProgram::Instruction) + 1);
+		start = std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+			bank.step();
+			program.run(bank.getOutputs());
+		}
+		double programTime = elapsedMicroseconds(start);
+		std::cout << levelCount << " levels: "
+			<< TREE_BENCHMARK_LENGTH / treeTime * 1e6 << "B/s vs "
+			<< TREE_BENCHMARK_LENGTH / programTime * 1e6 << "B/s, walking "
+			<< treeSize << "B in " << program.getInstructions().size()
+			<< " scattered nodes vs " << programSize << "B contiguous"
+			<< std::endl;
+		root.clear();
+		bank.clear();
+		program.clear();
+	}
+}
+
+void benchmarkBulkGenerate() {
+	std::cout << "Bulk generation: byte by byte vs bulk, "
+		<< TREE_BENCHMARK_LENGTH << "B" << std::endl;
+	for (unsigned int levelCount = 3; levelCount <= 6; levelCount++) {
+		Jabberwock jabberwock;
+		jabberwock.seed(BENCHMARK_SEED, levelCount);
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+			jabberwock.generate();
+		}
+		double byteTime = elapsedMicroseconds(start);
+		std::vector<uint8_t> buffer(TREE_BENCHMARK_LENGTH);
+		start = std::chrono::steady_clock::now();
+		jabberwock.generate(buffer.data(), buffer.size());
+		double bulkTime = elapsedMicroseconds(start);
+		std::cout << levelCount << " levels: "
+			<< TREE_BENCHMARK_LENGTH / byteTime * 1e6 << "B/s vs "
+			<< TREE_BENCHMARK_LENGTH / bulkTime * 1e6 << "B/s" << std::endl;
+		jabberwock.clear();
+	}
+}
+
+void benchmarkParallel() {
+	unsigned int threadCount = std::max(std::thread::hardware_concurrency(),
+		1u);
+	std::cout << "Parallel evaluation: 1 thread vs " << threadCount
+		<< " threads, " << PARALLEL_BENCHMARK_LENGTH << "B" << std::endl;
+	for (unsigned int levelCount = 4; levelCount <= 6; levelCount++) {
+		std::vector<uint8_t> buffer(PARALLEL_BENCHMARK_LENGTH);
+		double times[2] = { 0.0, 0.0, };
+		for (size_t i = 0; i < 2; i++) {
+			Jabberwock jabberwock;
+			jabberwock.setThreadCount(i == 0 ? 1 : threadCount);
+			jabberwock.seed(BENCHMARK_SEED, levelCount);
+			std::chrono::steady_clock::time_point start
+				= std::chrono::steady_clock::now();
+			jabberwock.generate(buffer);
+			times[i] = elapsedMicroseconds(start);
+			jabberwock.clear();
+		}
+		std::cout << levelCount << " levels: "
+			<< PARALLEL_BENCHMARK_LENGTH / times[0] * 1e6 << "B/s vs "
+			<< PARALLEL_BENCHMARK_LENGTH / times[1] * 1e6 << "B/s" << std::endl;
+	}
+}
+
+void benchmarkSeek() {
+	std::cout << "Seek: generating vs seeking " << SEEK_BENCHMARK_LENGTH
+		<< "B, seeking " << LONG_JUMP_BENCHMARK_LENGTH << "B" << std::endl;
+	for (unsigned int levelCount = 3; levelCount <= 5; levelCount++) {
+		Jabberwock jabberwock;
+		jabberwock.seed(BENCHMARK_SEED, levelCount);
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		for (uint64_t i = 0; i < SEEK_BENCHMARK_LENGTH; i++) {
+			jabberwock.generate();
+		}
+		double generatedTime = elapsedMicroseconds(start);
+		start = std::chrono::steady_clock::now();
+		jabberwock.seek(0);
+		jabberwock.seek(SEEK_BENCHMARK_LENGTH);
+		double seekedTime = elapsedMicroseconds(start);
+		start = std::chrono::steady_clock::now();
+		jabberwock.seek(LONG_JUMP_BENCHMARK_LENGTH);
+		double longSeekedTime = elapsedMicroseconds(start);
+		std::cout << levelCount << " levels: " << generatedTime << "us vs "
+			<< seekedTime << "us, " << longSeekedTime << "us" << std::endl;
+		jabberwock.clear();
+	}
+}
+
+void benchmarkSnapshot() {
+	std::cout << "Snapshot: seeding vs saving and loading" << std::endl;
+	for (unsigned int levelCount = 4; levelCount <= 6; levelCount++) {
+		Jabberwock seeded;
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		seeded.seed(BENCHMARK_SEED, levelCount);
+		double seedTime = elapsedMicroseconds(start);
+		std::stringstream snapshot;
+		start = std::chrono::steady_clock::now();
+		seeded.save(snapshot);
+		double saveTime = elapsedMicroseconds(start);
+		Jabberwock loaded;
+		start = std::chrono::steady_clock::now();
+		loaded.load(snapshot);
+		double loadTime = elapsedMicroseconds(start);
+		std::cout << levelCount << " levels: " << seedTime << "us vs "
+			<< saveTime << "us, " << loadTime << "us ("
+			<< snapshot.str().size() << "B)" << std::endl;
+		seeded.clear();
+		loaded.clear();
+	}
+}
+
+void benchmarkClone() {
+	std::cout << "Clone: seeding vs cloning" << std::endl;
+	for (unsigned int levelCount = 4; levelCount <= 6; levelCount++) {
+		Jabberwock seeded;
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		seeded.seed(BENCHMARK_SEED, levelCount);
+		double seedTime = elapsedMicroseconds(start);
+		Jabberwock copy;
+		start = std::chrono::steady_clock::now();
+		seeded.clone(copy);
+		double cloneTime = elapsedMicroseconds(start);
+		std::cout << levelCount << " levels: " << seedTime << "us vs "
+			<< cloneTime << "us" << std::endl;
+		seeded.clear();
+		copy.clear();
+	}
+}
+
+void benchmarkSubstreams() {
+	const size_t STREAM_COUNT = 8;
+	std::cout << "Substreams: seeding vs deriving " << STREAM_COUNT
+		<< " streams" << std::endl;
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	for (size_t i = 0; i < STREAM_COUNT; i++) {
+		Jabberwock stream;
+		stream.seed(BENCHMARK_SEED + std::to_string(i), 5);
+		stream.clear();
+	}
+	double seedTime = elapsedMicroseconds(start);
+	Jabberwock master;
+	master.seed(BENCHMARK_SEED, 5);
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < STREAM_COUNT; i++) {
+		Jabberwock stream;
+		master.substream(i, stream);
+		stream.clear();
+	}
+	double deriveTime = elapsedMicroseconds(start);
+	std::cout << "5 levels: " << seedTime << "us vs " << deriveTime << "us"
+		<< std::endl;
+	master.clear();
+}
+
+void benchmarkPrefetchBuffer() {
+	const size_t READ_LENGTH = 4096;
+	const size_t READ_COUNT = 256;
+	std::cout << "Prefetch buffer: generating vs reading " << READ_COUNT
+		<< " runs of " << READ_LENGTH << "B" << std::endl;
+	Jabberwock jabberwock;
+	jabberwock.seed(BENCHMARK_SEED, 5);
+	std::vector<uint8_t> buffer(READ_LENGTH);
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	for (size_t i = 0; i < READ_COUNT; i++) {
+		jabberwock.generate(buffer);
+	}
+	double generateTime = elapsedMicroseconds(start) / READ_COUNT;
+	PrefetchBuffer prefetch;
+	prefetch.start(jabberwock, 1 << 20);
+	// Let the producer fill the ring before timing the reads.
+	while (prefetch.getCounters().fillLevel < (1 << 19)) {
+		std::this_thread::yield();
+	}
+	start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < READ_COUNT; i++) {
+		prefetch.read(buffer.data(), READ_LENGTH);
+	}
+	double readTime = elapsedMicroseconds(start) / READ_COUNT;
+	PrefetchBuffer::Counters counters = prefetch.getCounters();
+	prefetch.stop();
+	std::cout << "5 levels: " << generateTime << "us vs " << readTime
+		<< "us per run, " << counters.underruns << " underruns, "
+		<< counters.producerThroughput << "B/s produced" << std::endl;
+	jabberwock.clear();
+}
+
+void benchmarkCodeGenerator() {
+	std::cout << "Code generator: byte by byte vs bulk vs emitted, "
+		<< TREE_BENCHMARK_LENGTH << "B" << std::endl;
+	// EmittedGenerator.h holds the 4-level tree of the benchmark seed.
+	Jabberwock jabberwock;
+	jabberwock.seed(BENCHMARK_SEED, 4);
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	for (uint64_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+		jabberwock.generate();
+	}
+	double byteTime = elapsedMicroseconds(start);
+	std::vector<uint8_t> buffer(TREE_BENCHMARK_LENGTH);
+	start = std::chrono::steady_clock::now();
+	jabberwock.generate(buffer.data(), buffer.size());
+	double bulkTime = elapsedMicroseconds(start);
+	EmittedGenerator emitted;
+	start = std::chrono::steady_clock::now();
+	emitted.generate(buffer.data(), buffer.size());
+	double emittedTime = elapsedMicroseconds(start);
+	std::cout << "4 levels: " << TREE_BENCHMARK_LENGTH / byteTime * 1e6
+		<< "B/s vs " << TREE_BENCHMARK_LENGTH / bulkTime * 1e6 << "B/s vs "
+		<< TREE_BENCHMARK_LENGTH / emittedTime * 1e6 << "B/s" << std::endl;
+	jabberwock.clear();
+}
+
+void benchmarkStatistics() {
+	std::cout << "Tree statistics and profile, " << TREE_BENCHMARK_LENGTH
+		<< "B" << std::endl;
+	const static std::string TYPE_NAMES[4] = { "XOR", "AND", "OR", "GLFSR", };
+	for (unsigned int levelCount = 3; levelCount <= 6; levelCount++) {
+		Jabberwock jabberwock;
+		jabberwock.seed(BENCHMARK_SEED, levelCount);
+		Jabberwock::Statistics statistics;
+		jabberwock.getStatistics(statistics);
+		std::cout << levelCount << " levels: depth " << statistics.depth;
+		for (size_t type = 0; type < 4; type++) {
+			std::cout << ", " << statistics.nodeCounts[type] << " "
+				<< TYPE_NAMES[type];
+		}
+		std::cout << ", " << statistics.stateBytes << "B state, "
+			<< statistics.heapBytes << "B heap" << std::endl;
+		std::vector<uint8_t> buffer(TREE_BENCHMARK_LENGTH);
+		jabberwock.generate(buffer.data(), buffer.size());
+		Jabberwock::Profile profile = jabberwock.getProfile();
+		if (profile.byteCount != 0) {
+			std::cout << "\tProfile:";
+			for (size_t type = 0; type < 4; type++) {
+				std::cout << " " << TYPE_NAMES[type] << " "
+					<< (double)profile.nanoseconds[type] / profile.byteCount
+					<< "ns/B";
+			}
+			std::cout << std::endl;
+		}
+		jabberwock.clear();
+	}
+}
+
+void benchmarkAsyncWriter() {
+	std::cout << "Asynchronous writer: ofstream vs async vs async synced, "
+		<< WRITER_BENCHMARK_LENGTH << "B" << std::endl;
+	const size_t BUFFER_LENGTH = 1 << 16;
+	std::string fileName = (std::filesystem::temp_directory_path()
+		/ "JabberwockAsyncWriterBenchmark.bin").string();
+	Jabberwock jabberwock;
+	jabberwock.setThreadCount(std::thread::hardware_concurrency());
+	jabberwock.seed(BENCHMARK_SEED, 3);
+	std::vector<uint8_t> buffer(BUFFER_LENGTH);
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	std::ofstream outputFile(fileName, std::ios::binary);
+	for (uint64_t i = 0; i < WRITER_BENCHMARK_LENGTH; i += BUFFER_LENGTH) {
+		jabberwock.generate(buffer.data(), BUFFER_LENGTH);
+		outputFile.write((const char*)buffer.data(), BUFFER_LENGTH);
+	}
+	outputFile.close();
+	double blockingTime = elapsedMicroseconds(start);
+	double asyncTimes[2];
+	SyncPolicy syncPolicies[2] = {
+		SyncPolicy::NEVER,
+		SyncPolicy::EVERY_BUFFER,
+	};
+	for (size_t p = 0; p < 2; p++) {
+		start = std::chrono::steady_clock::now();
+		AsyncWriter writer;
+		writer.open(fileName, BUFFER_LENGTH, syncPolicies[p]);
+		for (uint64_t i = 0; i < WRITER_BENCHMARK_LENGTH; i += BUFFER_LENGTH) {
+			jabberwock.generate(writer.getBuffer(), BUFFER_LENGTH);
+			writer.submit(BUFFER_LENGTH);
+		}
+		writer.close();
+		asyncTimes[p] = elapsedMicroseconds(start);
+	}
+	std::filesystem::remove(fileName);
+	std::cout << "3 levels: " << WRITER_BENCHMARK_LENGTH / blockingTime * 1e6
+		<< "B/s vs " << WRITER_BENCHMARK_LENGTH / asyncTimes[0] * 1e6
+		<< "B/s vs " << WRITER_BENCHMARK_LENGTH / asyncTimes[1] * 1e6
+		<< "B/s" << std::endl;
+	jabberwock.clear();
+}
+
+void benchmarkSampler() {
+	std::cout << "Sampler: 4-byte modulo vs sampler, " << TREE_BENCHMARK_LENGTH
+		<< " symbols" << std::endl;
+	const static std::string SYMBOL_NAMES[3] = {
+		"Dice", "Characters", "Floats",
+	};
+	for (size_t symbol = 0; symbol < 3; symbol++) {
+		Jabberwock jabberwock;
+		jabberwock.seed(BENCHMARK_SEED, 4);
+		// The modulo reduction spends 4 bytes on every symbol.
+		std::vector<uint8_t> buffer(4 * TREE_BENCHMARK_LENGTH);
+		std::chrono::steady_clock::time_point start
+			= std::chrono::steady_clock::now();
+		jabberwock.generate(buffer.data(), buffer.size());
+		// The symbols are summed into a volatile so that they are not dropped.
+		volatile uint64_t checksum = 0;
+		for (size_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+			uint32_t selector = (uint32_t)buffer[4 * i] << 24
+				| (uint32_t)buffer[4 * i + 1] << 16
+				| (uint32_t)buffer[4 * i + 2] << 8 | buffer[4 * i + 3];
+			checksum = checksum + (symbol == 0 ? selector % 6 : symbol == 1
+				? selector % 94 : (uint64_t)((float)selector / UINT_MAX));
+		}
+		double moduloTime = elapsedMicroseconds(start);
+		Sampler sampler(&jabberwock);
+		start = std::chrono::steady_clock::now();
+		for (size_t i = 0; i < TREE_BENCHMARK_LENGTH; i++) {
+			checksum = checksum + (symbol == 0 ? sampler.nextBelow(6)
+				: symbol == 1 ? sampler.nextIndex(94)
+				: (uint64_t)sampler.nextFloat(0.0f, 1.0f));
+		}
+		double samplerTime = elapsedMicroseconds(start);
+		std::cout << SYMBOL_NAMES[symbol] << ": " << TREE_BENCHMARK_LENGTH
+			/ moduloTime * 1e6 << " symbols/s (4B each) vs "
+			<< TREE_BENCHMARK_LENGTH / samplerTime * 1e6 << " symbols/s ("
+			<< (double)sampler.getConsumedBytes() / TREE_BENCHMARK_LENGTH
+			<< "B each)" << std::endl;
+		jabberwock.clear();
+	}
+}
+
+void benchmarkFormatPipeline() {
+	std::cout << "Format pipeline: ofstream vs pipeline, "
+		<< FORMAT_BENCHMARK_COUNT << " floats" << std::endl;
+	// The floats are drawn ahead, so that only formatting and writing are
+	// timed.
+	Jabberwock jabberwock;
+	jabberwock.seed(BENCHMARK_SEED, 3);
+	Sampler sampler(&jabberwock);
+	std::vector<float> floats(FORMAT_BENCHMARK_COUNT);
+	for (float& flt : floats) {
+		flt = sampler.nextFloat(-1000.0f, 1000.0f);
+	}
+	jabberwock.clear();
+	std::string fileName = (std::filesystem::temp_directory_path()
+		/ "JabberwockFormatPipelineBenchmark.txt").string();
+	std::chrono::steady_clock::time_point start
+		= std::chrono::steady_clock::now();
+	std::ofstream outputFile(fileName);
+	for (float flt : floats) {
+		outputFile << flt << ", ";
+	}
+	outputFile.close();
+	double sequentialTime = elapsedMicroseconds(start);
+	FormatPipeline pipeline;
+	pipeline.start(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+	start = std::chrono::steady_clock::now();
+	AsyncWriter writer;
+	writer.open(fileName, ASYNC_WRITER_BUFFER_LENGTH, SyncPolicy::NEVER);
+	size_t next = 0;
+	pipeline.run<float>(floats.size(), 18, writer, [&floats, &next]() {
+		return floats[next++];
+	}, [](char* output, float flt) {
+		output = std::to_chars(output, output + 16, (double)flt,
+			std::chars_format::general, 6).ptr;
+		*output++ = ',';
+		*output++ = ' ';
+		return output;
+	}, nullptr);
+	writer.close();
+	double pipelineTime = elapsedMicroseconds(start);
+	pipeline.stop();
+	std::filesystem::remove(fileName);
+	std::cout << std::thread::hardware_concurrency() << " threads: "
+		<< FORMAT_BENCHMARK_COUNT / sequentialTime * 1e6 << " floats/s vs "
+		<< FORMAT_BENCHMARK_COUNT / pipelineTime * 1e6 << " floats/s"
+		<< std::endl;
+}
+
+void runBenchmarks() {
+	benchmarkSeeding();
+	benchmarkSHA512Many();
+	benchmarkGLFSRJump();
+	benchmarkFixedGLFSR();
+	benchmarkTreeProgram();
+	benchmarkBulkGenerate();
+	benchmarkParallel();
+	benchmarkSeek();
+	benchmarkSnapshot();
+	benchmarkClone();
+	benchmarkSubstreams();
+	benchmarkPrefetchBuffer();
+	benchmarkCodeGenerator();
+	benchmarkStatistics();
+	benchmarkAsyncWriter();
+	benchmarkSampler();
+	benchmarkFormatPipeline();
+}
\ No newline at end of file
@@ -6,10 +6,14 @@ Purpose:	Implement the main entry point to the Jabberwock-test program for
 			the Jabberwock PRNG.
 */
 
+#include "Benchmark.h"
+#include "Verification.h"
+
+#include <Jabberwock/AsyncWriter.h>
 #include <Jabberwock/Jabberwock.h>
 
+#include <algorithm>
 #include <iostream>
-#include <fstream>
 #include <chrono>
 
 // Implement Jabberwock-Test module functions
@@ -17,16 +21,27 @@ Purpose:	Implement the main entry point to the Jabberwock-test program for
 // The set of standard printable characters.
 const static std::string CHARACTERS = "abcdefghijklmnopqrstuvwxyz`1234567890-=["
 	"]\\;',./ABCDEFGHIJKLMNOPQRSTUVWXYZ~!@#$%^&*()_+{}|:\"<>?";
+// The number of bytes to generate from the Jabberwock PRNG at once.
+const static size_t BUFFER_LENGTH = 1 << 16;
 
 /*
 The main entry point of the Jabberwock-Test program; generates 100x128502B data
-files using random seeds for 4-level Jabberwock PRNG trees.
+files using random seeds for 4-level Jabberwock PRNG trees, or runs the
+verification checks or benchmarks of the library if given the "verify" or
+"benchmark" argument.
 Parameter: int argc - The number of command line arguments for the program.
 Parameter: char** argv - The command line arguments for the program.
 Returns: int - The exit code of the program.
 */
 int main(int argc, char** argv) {
 	std::cout << "Jabberwock PRNG Test" << std::endl << std::endl;
+	if (argc > 1 && std::string(argv[1]) == "verify") {
+		return runVerification() ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	if (argc > 1 && std::string(argv[1]) == "benchmark") {
+		runBenchmarks();
+		return EXIT_SUCCESS;
+	}
 	std::cout << "Output file count: ";
 	std::string outputFileCountStr = "";
 	if (!std::getline(std::cin, outputFileCountStr)) {
@@ -107,25 +122,40 @@ int main(int argc, char** argv) {
 		for (size_t i = 0; i < 10; i++) {
 			progress[i] = false;
 		}
-		std::ofstream outputFile(outputFileName, std::ios::binary);
+		AsyncWriter outputFile;
+		if (!outputFile.open(outputFileName, BUFFER_LENGTH,
+			SyncPolicy::NEVER)) {
+			std::cout << "Invalid output file" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 		std::chrono::steady_clock::time_point start
 			= std::chrono::steady_clock::now();
-		for (size_t i = 0; i < outputFileSize; i++) {
+		bool success = true;
+		for (size_t i = 0; i < outputFileSize && success;
+			i += BUFFER_LENGTH) {
+			size_t length = std::min(BUFFER_LENGTH, outputFileSize - i);
+			jabberwock.generate(outputFile.getBuffer(), length);
+			success = outputFile.submit(length);
+			size_t last = i + length - 1;
 			for (size_t j = 0; j < 10; j++) {
-				if ((float)i / (float)outputFileSize > (float)j / 10.0f
+				if ((float)last / (float)outputFileSize > (float)j / 10.0f
 					&& !progress[j]) {
 					progress[j] = true;
 					std::cout << (j * 10.0f) << "%, ";
 				}
 			}
-			uint8_t outputByte = jabberwock.generate();
-			outputFile.write((const char*)(&outputByte), 1);
 		}
+		success &= outputFile.close();
 		std::chrono::steady_clock::time_point end
 			= std::chrono::steady_clock::now();
+		if (!success) {
+			std::cout << "Writing the output file failed" << std::endl;
+			jabberwock.clear();
+			return EXIT_FAILURE;
+		}
 		std::cout << "Generated in " << std::chrono::duration_cast<
 			std::chrono::seconds>(end - start).count() << "s" << std::endl;
-		outputFile.close();
 		jabberwock.clear();
 		std::cout << "Cleared Jabberwock PRNG" << std::endl << std::endl;
 	}
@@ -0,0 +1,1222 @@
+/*
+File:		Verification.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@10:05
+Purpose:	Implement the verification checks found in Verification.h.
+*/
+
+#include "EmittedGenerator.h"
+#include "Verification.h"
+
+#include <Jabberwock/AsyncWriter.h>
+#include <Jabberwock/FormatPipeline.h>
+#include <Jabberwock/Jabberwock.h>
+#include <Jabberwock/PackedFormat.h>
+#include <Jabberwock/PrefetchBuffer.h>
+#include <Jabberwock/Sampler.h>
+#include <Jabberwock/Utilities.h>
+
+#include <algorithm>
+#include <bit>
+#include <cfloat>
+#include <charconv>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+// Implement Verification module functions.
+
+// The number of bytes to compare in each GLFSR check.
+const static size_t GLFSR_CHECK_LENGTH = 65536;
+// The step counts to compare jumping and stepping GLFSRs by.
+const static std::vector<uint64_t> JUMP_CHECK_STEPS = {
+	0, 1, 7, 8, 63, 64, 65, 1000, 1024, 12345, 100003,
+};
+// The number of bytes to compare in each tree check.
+const static size_t TREE_CHECK_LENGTH = 4096;
+// The seeds of the trees to compare in each tree check.
+const static std::vector<std::string> CHECK_SEEDS = {
+	"TestSeedData",
+	"QxXVWF)?C/.N`Yw$r<:7S/G6$XuTOuyQ[$s8{e]Nu=eQ%x-`m1*2]yiI{h$U)m^.",
+};
+// The number of levels of the tree in EmittedGenerator.h, which the Generator
+// program wrote for the first check seed; rewrite it there if the code
+// generator's output changes.
+const static unsigned int EMITTED_LEVEL_COUNT = 4;
+// The names of the instruction sets.
+const static std::vector<std::string> INSTRUCTION_SET_NAMES = {
+	"scalar",
+	"SSE2",
+	"AVX2",
+};
+
+/*
+Generate the reference output of an unbanked tree.
+Parameter: const std::string& seed - The seed of the tree.
+Parameter: unsigned int levelCount - The number of levels in the tree.
+Parameter: size_t length - The number of bytes to generate.
+Returns: std::vector<uint8_t> - The generated bytes.
+*/
+static std::vector<uint8_t> referenceOutput(const std::string& seed,
+	unsigned int levelCount, size_t length) {
+	NodeArena arena;
+	XORNode root(&arena);
+	root.seed(seed, levelCount - 1);
+	std::vector<uint8_t> output(length);
+	for (size_t i = 0; i < length; i++) {
+		output[i] = root.generate();
+	}
+	root.clear();
+	return output;
+}
+
+/*
+Count the nodes of an unbanked tree into statistics, the way the Jabberwock
+PRNG describes its seeded tree.
+Parameter: const Node& node - The root node of the tree to count.
+Parameter: Jabberwock::Statistics& statistics - The statistics to count into.
+Returns: size_t - The number of levels from the node to its deepest GLFSRs.
+*/
+static size_t countReferenceNodes(const Node& node,
+	Jabberwock::Statistics& statistics) {
+	statistics.nodeCounts[(size_t)node.getType()]++;
+	if (node.getType() == NodeType::GLFSR) {
+		size_t config = node.getGLFSR()->getConfig();
+		statistics.configCounts[config]++;
+		statistics.stateBytes += (GLFSR_CONFIGS[config][0] + 63) / 64
+			* sizeof(uint64_t);
+		return 1;
+	}
+	size_t depth = 0;
+	for (const Node* child : node.getChildren()) {
+		depth = std::max(depth, countReferenceNodes(*child, statistics));
+	}
+	return depth + 1;
+}
+
+bool verifySHA512Raw() {
+	std::string input = "";
+	for (size_t length = 0; length <= 300; length++) {
+		SHA512Digest digest = SHA512Raw(input);
+		std::string hex = "";
+		for (uint8_t byte : digest) {
+			hex += HEX_CHARACTERS[byte >> 4];
+			hex += HEX_CHARACTERS[byte & 0x0F];
+		}
+		if (hex != SHA512String(input)) {
+			std::cout << "Raw digest differs for a " << length << "B input"
+				<< std::endl;
+			return false;
+		}
+		// The reference may measure its input up to the first NUL, so the
+		// inputs have none.
+		input += (char)(1 + (length * 37 + 11) % 255);
+	}
+	return true;
+}
+
+// The message lengths to compare multi-buffer SHA-512 digests at, on either side
+// of the padding and block boundaries.
+const static std::vector<size_t> MANY_CHECK_LENGTHS = {
+	0, 1, 4, 8, 111, 112, 127, 128, 129, 239, 240, 256, 300,
+};
+
+bool verifySHA512Many() {
+	InstructionSet supported = detectInstructionSet();
+	for (size_t set = 0; set <= (size_t)supported; set++) {
+		for (size_t length : MANY_CHECK_LENGTHS) {
+			for (size_t count = 0; count <= 9; count++) {
+				// The messages have no NUL bytes, which the reference may
+				// stop measuring its input at.
+				std::string inputs(length * count, '\0');
+				for (size_t i = 0; i < inputs.length(); i++) {
+					inputs[i] = (char)(1 + (i * 53 + length + 7) % 255);
+				}
+				std::vector<SHA512Digest> digests(count);
+				SHA512RawMany((const uint8_t*)inputs.data(), length, count,
+					digests.data(), (InstructionSet)set);
+				for (size_t i = 0; i < count; i++) {
+					std::string hex = "";
+					for (uint8_t byte : digests[i]) {
+						hex += HEX_CHARACTERS[byte >> 4];
+						hex += HEX_CHARACTERS[byte & 0x0F];
+					}
+					if (hex != SHA512String(inputs.substr(i * length,
+						length))) {
+						std::cout << "Digest " << i << " of " << count << " "
+							<< length << "B inputs differs with "
+							<< INSTRUCTION_SET_NAMES[set] << std::endl;
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+/*
+Permute a string the way permuteString did with substrings, for reference.
+Parameter: const std::string& input - The input string.
+Returns: std::string - The permuted string.
+*/
+static std::string referencePermutation(const std::string& input) {
+	std::string permutation = input;
+	std::string seedHashString = SHA512String(input);
+	size_t paddingIndex = 0;
+	do {
+		permutation += seedHashString[paddingIndex];
+		paddingIndex++;
+	} while (permutation.length() % 8 != 0);
+	std::vector<std::string> chunks4;
+	for (size_t i = 0; i < permutation.length(); i += 4) {
+		chunks4.push_back(permutation.substr(i, 4));
+	}
+	permutation.clear();
+	for (size_t i = 0; i < chunks4.size(); i++) {
+		std::vector<bool> chunk4HashBinary = SHA512Binary(chunks4[i]);
+		uint8_t permutation4Index = 0x00;
+		for (size_t j = 508; j < 512; j++) {
+			permutation4Index <<= 1;
+			permutation4Index |= (uint8_t)chunk4HashBinary[j];
+		}
+		for (size_t j = 0; j < 4; j++) {
+			permutation += chunks4[i][PERMUTATIONS_4[permutation4Index][j] - 1];
+		}
+	}
+	std::vector<std::string> chunks8(8);
+	size_t chunk8Length = permutation.length() / 8;
+	for (size_t i = 0; i < 8; i++) {
+		chunks8[i] = permutation.substr(i * chunk8Length, chunk8Length);
+	}
+	std::vector<bool> permutationHashBinary = SHA512Binary(permutation);
+	uint8_t permutation8Index = 0x00;
+	for (size_t i = 508; i < 512; i++) {
+		permutation8Index <<= 1;
+		permutation8Index |= (uint8_t)permutationHashBinary[i];
+	}
+	permutation.clear();
+	for (size_t i = 0; i < 8; i++) {
+		permutation += chunks8[PERMUTATIONS_8[permutation8Index][i] - 1];
+	}
+	return permutation;
+}
+
+bool verifyPermuteString() {
+	for (const std::string& seed : CHECK_SEEDS) {
+		std::string permutation = seed;
+		std::vector<char> buffer(seed.begin(), seed.end());
+		size_t length = seed.length();
+		for (size_t i = 0; i < 40; i++) {
+			std::string expected = referencePermutation(permutation);
+			permutation = permuteString(permutation);
+			buffer.resize(permutedLength(length));
+			length = permuteString(buffer.data(), length, buffer.data());
+			if (permutation != expected
+				|| std::string(buffer.data(), length) != expected) {
+				std::cout << "Permutation " << i << " differs" << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool verifyGLFSRKernel() {
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		SHA512Digest stateDigest = SHA512Raw("GLFSR"
+			+ std::to_string(config));
+		GLFSR kernel;
+		kernel.seed(config, stateDigest);
+		GLFSR serial;
+		serial.seed(config, stateDigest);
+		for (size_t i = 0; i < GLFSR_CHECK_LENGTH; i++) {
+			if (kernel.generate() != serial.generateSerial()) {
+				std::cout << "GLFSR configuration " << config
+					<< " diverged at byte " << i << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool verifyGLFSRJump() {
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		SHA512Digest stateDigest = SHA512Raw("GLFSR"
+			+ std::to_string(config));
+		for (uint64_t steps : JUMP_CHECK_STEPS) {
+			GLFSR jumped;
+			jumped.seed(config, stateDigest);
+			jumped.jump(steps);
+			GLFSR stepped;
+			stepped.seed(config, stateDigest);
+			for (uint64_t i = 0; i < steps; i++) {
+				stepped.step();
+			}
+			if (jumped.getState() != stepped.getState()) {
+				std::cout << "GLFSR configuration " << config
+					<< " diverged after jumping " << steps << " steps"
+					<< std::endl;
+				return false;
+			}
+		}
+		GLFSR jumped;
+		jumped.seed(config, stateDigest);
+		jumped.jump(1ULL << 40);
+		jumped.jump(12345);
+		GLFSR combined;
+		combined.seed(config, stateDigest);
+		combined.jump((1ULL << 40) + 12345);
+		if (jumped.getState() != combined.getState()) {
+			std::cout << "GLFSR configuration " << config
+				<< " diverged after jumping 2^40 steps" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool verifyFixedGLFSR() {
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		SHA512Digest stateDigest = SHA512Raw("GLFSR"
+			+ std::to_string(config));
+		FixedGLFSRVariant fixed = makeFixedGLFSR(config);
+		bool matched = fixed.index() == config && std::visit([&](auto& glfsr) {
+			using Fixed = std::remove_reference_t<decltype(glfsr)>;
+			if (Fixed::LENGTH != GLFSR_CONFIGS[config][0]
+				|| (Fixed::FEEDBACK_TABLE.data() == GLFSRFeedbackTable(config))
+				!= Fixed::BYTE_STEP) {
+				return false;
+			}
+			glfsr.seed(stateDigest);
+			GLFSR serial;
+			serial.seed(config, stateDigest);
+			// A step between bytes moves the output off byte boundaries.
+			for (size_t i = 0; i < GLFSR_CHECK_LENGTH; i++) {
+				if (glfsr.generate() != serial.generateSerial()
+					|| glfsr.step() != serial.step()) {
+					return false;
+				}
+			}
+			return std::equal(glfsr.getState().begin(), glfsr.getState().end(),
+				serial.getState().begin(), serial.getState().end());
+		}, fixed);
+		if (!matched) {
+			std::cout << "Fixed GLFSR configuration " << config
+				<< " diverged from the GLFSR" << std::endl;
+			return false;
+		}
+	}
+	return true;
+}
+
+bool verifyLeafBank() {
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 3; levelCount <= 4; levelCount++) {
+			std::vector<uint8_t> reference = referenceOutput(seed, levelCount,
+				TREE_CHECK_LENGTH);
+			for (size_t set = 0; set <= (size_t)detectInstructionSet(); set++) {
+				NodeArena arena;
+				XORNode root(&arena);
+				root.seed(seed, levelCount - 1);
+				LeafBank bank;
+				root.bankLeaves(bank);
+				bank.finalize();
+				bank.setInstructionSet((InstructionSet)set);
+				for (size_t i = 0; i < TREE_CHECK_LENGTH; i++) {
+					bank.step();
+					if (root.generate() != reference[i]) {
+						std::cout << INSTRUCTION_SET_NAMES[set]
+							<< " leaf bank diverged at byte " << i
+							<< " of a " << levelCount << "-level tree"
+							<< std::endl;
+						return false;
+					}
+				}
+				root.clear();
+				bank.clear();
+			}
+		}
+	}
+	return true;
+}
+
+bool verifyNodeArena() {
+	NodeArena arena;
+	XORNode root(&arena);
+	size_t capacity = 0;
+	size_t used = 0;
+	for (size_t i = 0; i < 3; i++) {
+		for (const std::string& seed : CHECK_SEEDS) {
+			std::vector<uint8_t> reference = referenceOutput(seed, 4,
+				TREE_CHECK_LENGTH);
+			root.seed(seed, 3);
+			for (size_t j = 0; j < TREE_CHECK_LENGTH; j++) {
+				if (root.generate() != reference[j]) {
+					std::cout << "Reseeded tree diverged at byte " << j
+						<< std::endl;
+					return false;
+				}
+			}
+			root.release();
+			if (i == 0) {
+				capacity = std::max(capacity, arena.getCapacity());
+				used = std::max(used, arena.getUsed());
+			}
+			else if (arena.getCapacity() != capacity) {
+				std::cout << "Reseeding grew the node arena from " << capacity
+					<< "B to " << arena.getCapacity() << "B" << std::endl;
+				return false;
+			}
+			arena.reset();
+			if (arena.getUsed() != 0) {
+				std::cout << "Resetting left " << arena.getUsed()
+					<< "B of the node arena in use" << std::endl;
+				return false;
+			}
+		}
+	}
+	return used > 0;
+}
+
+bool verifyTreeProgram() {
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 2; levelCount <= 5; levelCount++) {
+			std::vector<uint8_t> reference = referenceOutput(seed, levelCount,
+				TREE_CHECK_LENGTH);
+			Jabberwock jabberwock;
+			jabberwock.seed(seed, levelCount);
+			for (size_t i = 0; i < TREE_CHECK_LENGTH; i++) {
+				if (jabberwock.generate() != reference[i]) {
+					std::cout << "Tree program diverged at byte " << i
+						<< " of a " << levelCount << "-level tree" << std::endl;
+					return false;
+				}
+			}
+			jabberwock.clear();
+		}
+	}
+	return true;
+}
+
+bool verifyBulkGenerate() {
+	const std::vector<size_t> LENGTHS = { 1, 255, 256, 257, 3, 1000, 0, 511, };
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 3; levelCount <= 4; levelCount++) {
+			std::vector<uint8_t> reference = referenceOutput(seed, levelCount,
+				TREE_CHECK_LENGTH);
+			Jabberwock jabberwock;
+			jabberwock.seed(seed, levelCount);
+			std::vector<uint8_t> output(TREE_CHECK_LENGTH);
+			size_t offset = 0;
+			for (size_t i = 0; offset < TREE_CHECK_LENGTH; i++) {
+				size_t length = std::min(LENGTHS[i % LENGTHS.size()],
+					TREE_CHECK_LENGTH - offset);
+				if (i % 3 == 2 && length > 0) {
+					output[offset] = jabberwock.generate();
+					offset++;
+					length--;
+				}
+				jabberwock.generate(std::span<uint8_t>(output.data() + offset,
+					length));
+				offset += length;
+			}
+			if (output != reference
+				|| jabberwock.getPosition() != TREE_CHECK_LENGTH) {
+				std::cout << "Bulk generation diverged from a " << levelCount
+					<< "-level tree" << std::endl;
+				return false;
+			}
+			jabberwock.clear();
+		}
+	}
+	return true;
+}
+
+bool verifyParallel() {
+	const std::vector<unsigned int> THREAD_COUNTS = { 2, 3, 8, };
+	const size_t LENGTH = 2 * JABBERWOCK_PARALLEL_LENGTH + 1234;
+	const size_t SPLIT = 1000;
+	const size_t SEEK_OFFSET = 5000;
+	const size_t COMPARE_LENGTH = 64;
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 3; levelCount <= 5; levelCount++) {
+			Jabberwock sequential;
+			sequential.seed(seed, levelCount);
+			std::vector<uint8_t> reference(LENGTH);
+			sequential.generate(reference);
+			sequential.clear();
+			for (unsigned int threadCount : THREAD_COUNTS) {
+				Jabberwock parallel;
+				parallel.setThreadCount(threadCount);
+				parallel.seed(seed, levelCount);
+				std::vector<uint8_t> output(LENGTH);
+				parallel.generate(output.data(), SPLIT);
+				output[SPLIT] = parallel.generate();
+				parallel.generate(output.data() + SPLIT + 1,
+					LENGTH - SPLIT - 1);
+				parallel.seek(SEEK_OFFSET);
+				std::vector<uint8_t> seeked(COMPARE_LENGTH);
+				parallel.generate(seeked);
+				if (output != reference || !std::equal(seeked.begin(),
+					seeked.end(), reference.begin() + SEEK_OFFSET)) {
+					std::cout << threadCount << " threads diverged from a "
+						<< levelCount << "-level tree" << std::endl;
+					return false;
+				}
+				parallel.clear();
+			}
+		}
+	}
+	return true;
+}
+
+bool verifyParallelSeeding() {
+	ThreadPool pool;
+	pool.start(3);
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 2; levelCount <= 5; levelCount++) {
+			std::vector<uint8_t> reference = referenceOutput(seed, levelCount,
+				TREE_CHECK_LENGTH);
+			NodeArena arena;
+			XORNode root(&arena);
+			root.seed(seed, levelCount - 1, &pool);
+			for (size_t i = 0; i < TREE_CHECK_LENGTH; i++) {
+				if (root.generate() != reference[i]) {
+					std::cout << "Byte " << i << " of a " << levelCount
+						<< "-level tree differs" << std::endl;
+					return false;
+				}
+			}
+			root.clear();
+		}
+	}
+	return true;
+}
+
+bool verifySeek() {
+	const std::vector<uint64_t> OFFSETS = { 4000, 1, 0, 2048, 2047, 3333, 17, };
+	const size_t COMPARE_LENGTH = 64;
+	for (const std::string& seed : CHECK_SEEDS) {
+		Jabberwock reference;
+		reference.seed(seed, 4);
+		std::vector<uint8_t> output(TREE_CHECK_LENGTH + COMPARE_LENGTH);
+		for (size_t i = 0; i < output.size(); i++) {
+			output[i] = reference.generate();
+		}
+		reference.clear();
+		Jabberwock jabberwock;
+		jabberwock.seed(seed, 4);
+		jabberwock.discard(100);
+		jabberwock.generate();
+		jabberwock.discard(899);
+		if (jabberwock.getPosition() != 1000
+			|| jabberwock.generate() != output[1000]) {
+			std::cout << "Discarding diverged at byte 1000" << std::endl;
+			return false;
+		}
+		for (uint64_t offset : OFFSETS) {
+			jabberwock.seek(offset);
+			for (size_t i = 0; i < COMPARE_LENGTH; i++) {
+				if (jabberwock.generate() != output[offset + i]) {
+					std::cout << "Seeking diverged at byte " << offset + i
+						<< std::endl;
+					return false;
+				}
+			}
+		}
+		jabberwock.clear();
+	}
+	return true;
+}
+
+bool verifySnapshot() {
+	const size_t SPLIT = 1000;
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 3; levelCount <= 5; levelCount++) {
+			for (unsigned int threadCount = 1; threadCount <= 3;
+				threadCount += 2) {
+				Jabberwock saved;
+				saved.setThreadCount(threadCount);
+				saved.seed(seed, levelCount);
+				std::vector<uint8_t> reference(TREE_CHECK_LENGTH);
+				saved.generate(reference.data(), SPLIT);
+				std::stringstream snapshot;
+				if (!saved.save(snapshot)) {
+					std::cout << "Saving a " << levelCount << "-level tree "
+						"failed" << std::endl;
+					return false;
+				}
+				saved.generate(reference.data() + SPLIT,
+					TREE_CHECK_LENGTH - SPLIT);
+				Jabberwock loaded;
+				loaded.setThreadCount(4 - threadCount);
+				std::vector<uint8_t> output(TREE_CHECK_LENGTH);
+				bool loadedSnapshot = loaded.load(snapshot);
+				if (loadedSnapshot) {
+					loadedSnapshot = loaded.getPosition() == SPLIT;
+					loaded.generate(output.data() + SPLIT,
+						TREE_CHECK_LENGTH - SPLIT);
+					loaded.seek(0);
+					loaded.generate(output.data(), SPLIT);
+				}
+				if (!loadedSnapshot || output != reference) {
+					std::cout << "A loaded " << levelCount << "-level tree "
+						"diverged" << std::endl;
+					return false;
+				}
+				// Truncated snapshots and snapshots of other versions are
+				// refused.
+				std::string bytes = snapshot.str();
+				std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+				std::string versioned = bytes;
+				versioned[4]++;
+				std::stringstream otherVersion(versioned);
+				if (loaded.load(truncated) || loaded.load(otherVersion)
+					|| loaded.getPosition() != 0) {
+					std::cout << "A damaged snapshot was loaded" << std::endl;
+					return false;
+				}
+				saved.clear();
+			}
+		}
+	}
+	Jabberwock unseeded;
+	std::stringstream snapshot;
+	if (unseeded.save(snapshot)) {
+		std::cout << "An unseeded PRNG was saved" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifyClone() {
+	const size_t SPLIT = 1000;
+	for (const std::string& seed : CHECK_SEEDS) {
+		for (unsigned int levelCount = 3; levelCount <= 5; levelCount++) {
+			for (unsigned int threadCount = 1; threadCount <= 3;
+				threadCount += 2) {
+				Jabberwock original;
+				original.setThreadCount(threadCount);
+				original.seed(seed, levelCount);
+				std::vector<uint8_t> reference(TREE_CHECK_LENGTH);
+				original.generate(reference.data(), SPLIT);
+				Jabberwock copy;
+				if (!original.clone(copy)) {
+					std::cout << "Cloning a " << levelCount << "-level tree "
+						"failed" << std::endl;
+					return false;
+				}
+				// The original runs ahead first, which must not move the
+				// clone.
+				original.generate(reference.data() + SPLIT,
+					TREE_CHECK_LENGTH - SPLIT);
+				std::vector<uint8_t> output(TREE_CHECK_LENGTH);
+				copy.generate(output.data() + SPLIT,
+					TREE_CHECK_LENGTH - SPLIT);
+				copy.seek(0);
+				copy.generate(output.data(), SPLIT);
+				if (output != reference
+					|| copy.getThreadCount() != threadCount) {
+					std::cout << "A cloned " << levelCount << "-level tree "
+						"diverged" << std::endl;
+					return false;
+				}
+				original.clear();
+				copy.clear();
+			}
+		}
+	}
+	Jabberwock unseeded;
+	Jabberwock copy;
+	if (unseeded.clone(copy)) {
+		std::cout << "An unseeded PRNG was cloned" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifySubstreams() {
+	const size_t STREAM_COUNT = 4;
+	const size_t COMPARE_LENGTH = 256;
+	for (const std::string& seed : CHECK_SEEDS) {
+		Jabberwock master;
+		master.seed(seed, 4);
+		// Each thread derives its own substream and generates from it.
+		std::vector<std::vector<uint8_t>> outputs(STREAM_COUNT,
+			std::vector<uint8_t>(COMPARE_LENGTH));
+		std::vector<std::thread> threads;
+		for (size_t i = 0; i < STREAM_COUNT; i++) {
+			threads.emplace_back([&master, &outputs, i]() {
+				Jabberwock stream;
+				if (master.substream(i, stream)) {
+					stream.generate(outputs[i]);
+				}
+			});
+		}
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+		for (size_t i = 0; i < STREAM_COUNT; i++) {
+			master.seek(i * JABBERWOCK_SUBSTREAM_LENGTH);
+			std::vector<uint8_t> expected(COMPARE_LENGTH);
+			master.generate(expected);
+			if (outputs[i] != expected) {
+				std::cout << "Substream " << i << " differs" << std::endl;
+				return false;
+			}
+		}
+		if (outputs[0] == outputs[1]) {
+			std::cout << "Substreams 0 and 1 are equal" << std::endl;
+			return false;
+		}
+		Jabberwock stream;
+		if (master.substream(JABBERWOCK_SUBSTREAM_COUNT, stream)) {
+			std::cout << "An out-of-range substream was derived" << std::endl;
+			return false;
+		}
+		master.clear();
+	}
+	return true;
+}
+
+bool verifyPrefetchBuffer() {
+	// A small ring makes the reads wrap around it and wait for the producer.
+	const size_t CAPACITY = 4096;
+	const size_t LENGTH = 1 << 18;
+	const std::vector<size_t> READ_LENGTHS = { 1, 100, 2047, 2048, 5000, 333, };
+	const size_t CONSUMER_COUNT = 4;
+	Jabberwock source;
+	source.seed(CHECK_SEEDS[0], 4);
+	source.discard(777);
+	Jabberwock reference;
+	source.clone(reference);
+	std::vector<uint8_t> expected(3 * LENGTH);
+	reference.generate(expected);
+	PrefetchBuffer buffer;
+	buffer.start(source, CAPACITY);
+	size_t offset = 0;
+	for (size_t i = 0; offset < LENGTH; i++) {
+		size_t length = READ_LENGTHS[i % READ_LENGTHS.size()];
+		std::vector<uint8_t> output(length);
+		uint64_t first = buffer.read(output.data(), length);
+		if (first != 777 + offset || !std::equal(output.begin(), output.end(),
+			expected.begin() + offset)) {
+			std::cout << "A read at " << offset << " differs" << std::endl;
+			return false;
+		}
+		offset += length;
+	}
+	// Concurrent consumers claim runs in an unknown order, but together they
+	// must cover the output with runs placed at their reported offsets.
+	std::vector<uint8_t> covered(expected.size(), 0);
+	std::vector<uint8_t> matched(CONSUMER_COUNT, 1);
+	std::vector<std::thread> consumers;
+	size_t consumerLength = LENGTH / CONSUMER_COUNT;
+	for (size_t c = 0; c < CONSUMER_COUNT; c++) {
+		consumers.emplace_back([&, c]() {
+			for (size_t read = 0, i = c; read < consumerLength; i++) {
+				size_t length = std::min(READ_LENGTHS[i % READ_LENGTHS.size()],
+					consumerLength - read);
+				std::vector<uint8_t> output(length);
+				size_t first = (size_t)(buffer.read(output.data(), length)
+					- 777);
+				if (!std::equal(output.begin(), output.end(),
+					expected.begin() + first)) {
+					matched[c] = 0;
+				}
+				std::fill(covered.begin() + first,
+					covered.begin() + first + length, 1);
+				read += length;
+			}
+		});
+	}
+	for (std::thread& consumer : consumers) {
+		consumer.join();
+	}
+	PrefetchBuffer::Counters counters = buffer.getCounters();
+	buffer.stop();
+	if (std::find(matched.begin(), matched.end(), 0) != matched.end()
+		|| std::find(covered.begin() + offset, covered.begin() + offset
+		+ consumerLength * CONSUMER_COUNT, 0) != covered.begin() + offset
+		+ consumerLength * CONSUMER_COUNT) {
+		std::cout << "Concurrent reads differ" << std::endl;
+		return false;
+	}
+	if (counters.producedBytes < offset + consumerLength * CONSUMER_COUNT) {
+		std::cout << "The producer counter is behind the reads" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifyCodeGenerator() {
+	Jabberwock jabberwock;
+	jabberwock.seed(CHECK_SEEDS[0], EMITTED_LEVEL_COUNT);
+	EmittedGenerator emitted;
+	std::vector<uint8_t> reference(GLFSR_CHECK_LENGTH);
+	std::vector<uint8_t> output(GLFSR_CHECK_LENGTH);
+	jabberwock.generate(reference.data(), GLFSR_CHECK_LENGTH);
+	emitted.generate(output.data(), GLFSR_CHECK_LENGTH);
+	if (output != reference
+		|| emitted.getPosition() != jabberwock.getPosition()) {
+		std::cout << "The emitted generator diverged" << std::endl;
+		return false;
+	}
+	// Emitting starts the generated class at the PRNG's position, gives the
+	// same source every time, and refuses class names which are not
+	// identifiers and PRNGs which are not seeded.
+	std::stringstream first;
+	std::stringstream second;
+	std::stringstream invalid;
+	Jabberwock unseeded;
+	if (!jabberwock.emitSource(first, "EmittedGenerator")
+		|| !jabberwock.emitSource(second, "EmittedGenerator")
+		|| first.str() != second.str()
+		|| first.str().find("START_POSITION = "
+			+ std::to_string(GLFSR_CHECK_LENGTH) + "ULL;") == std::string::npos
+		|| jabberwock.emitSource(invalid, "Emitted Generator")
+		|| unseeded.emitSource(invalid, "EmittedGenerator")) {
+		std::cout << "Emitting source failed" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifyStatistics() {
+	Jabberwock unseeded;
+	Jabberwock::Statistics statistics;
+	if (unseeded.getStatistics(statistics)) {
+		std::cout << "An unseeded PRNG gave statistics" << std::endl;
+		return false;
+	}
+	for (unsigned int levelCount = 3; levelCount <= 5; levelCount++) {
+		NodeArena arena;
+		XORNode root(&arena);
+		root.seed(CHECK_SEEDS[0], levelCount - 1);
+		Jabberwock::Statistics reference = {};
+		reference.configCounts.assign(GLFSR_CONFIGS.size(), 0);
+		reference.depth = countReferenceNodes(root, reference);
+		root.clear();
+		for (unsigned int threadCount : { 1u, 3u, }) {
+			Jabberwock jabberwock;
+			jabberwock.setThreadCount(threadCount);
+			jabberwock.seed(CHECK_SEEDS[0], levelCount);
+			if (!jabberwock.getStatistics(statistics)
+				|| !std::equal(statistics.nodeCounts,
+					statistics.nodeCounts + 4, reference.nodeCounts)
+				|| statistics.depth != reference.depth
+				|| statistics.configCounts != reference.configCounts
+				|| statistics.stateBytes != reference.stateBytes
+				|| statistics.heapBytes < statistics.stateBytes
+				|| statistics.subtreeCount == 0) {
+				std::cout << "Statistics of " << levelCount << " levels with "
+					<< threadCount << " threads mismatched" << std::endl;
+				return false;
+			}
+			// Times are only collected in profiling builds, but the profile
+			// always reads back zero after a reset.
+			std::vector<uint8_t> output(TREE_CHECK_LENGTH);
+			jabberwock.generate(output.data(), output.size());
+			jabberwock.resetProfile();
+			Jabberwock::Profile profile = jabberwock.getProfile();
+			if (profile.byteCount != 0 || std::any_of(profile.nanoseconds,
+				profile.nanoseconds + 4, [](uint64_t time) {
+				return time != 0; })) {
+				std::cout << "Resetting the profile failed" << std::endl;
+				return false;
+			}
+			jabberwock.clear();
+		}
+	}
+	return true;
+}
+
+bool verifyAsyncWriter() {
+	// Small buffers make the writes span many buffers and wait on the I/O
+	// thread; copied writes straddle the buffer boundaries.
+	const size_t BUFFER_LENGTH = 1000;
+	const std::vector<size_t> WRITE_LENGTHS = { 1, 999, 1000, 1001, 3333, 7, };
+	std::string fileName = (std::filesystem::temp_directory_path()
+		/ "JabberwockAsyncWriterCheck.bin").string();
+	Jabberwock jabberwock;
+	jabberwock.seed(CHECK_SEEDS[0], 3);
+	std::vector<uint8_t> expected(1 << 16);
+	jabberwock.generate(expected);
+	for (SyncPolicy syncPolicy : { SyncPolicy::NEVER, SyncPolicy::ON_CLOSE,
+		SyncPolicy::EVERY_BUFFER, }) {
+		AsyncWriter writer;
+		if (!writer.open(fileName, BUFFER_LENGTH, syncPolicy)) {
+			std::cout << "Opening the check file failed" << std::endl;
+			return false;
+		}
+		// The first half is submitted in place and the second half copied.
+		size_t offset = 0;
+		bool success = true;
+		for (size_t i = 0; offset < expected.size() / 2; i++) {
+			size_t length = std::min({ WRITE_LENGTHS[i % WRITE_LENGTHS.size()],
+				writer.getBufferLength(), expected.size() / 2 - offset, });
+			std::copy(expected.begin() + offset,
+				expected.begin() + offset + length, writer.getBuffer());
+			success &= writer.submit(length);
+			offset += length;
+		}
+		for (size_t i = 0; offset < expected.size(); i++) {
+			size_t length = std::min(WRITE_LENGTHS[i % WRITE_LENGTHS.size()],
+				expected.size() - offset);
+			success &= writer.write(expected.data() + offset, length);
+			offset += length;
+		}
+		success &= writer.close();
+		std::ifstream input(fileName, std::ios::binary);
+		std::vector<uint8_t> output((std::istreambuf_iterator<char>(input)),
+			std::istreambuf_iterator<char>());
+		input.close();
+		if (!success || output != expected
+			|| writer.getWrittenBytes() != expected.size()) {
+			std::cout << "The written file differs with sync policy "
+				<< (size_t)syncPolicy << std::endl;
+			std::filesystem::remove(fileName);
+			return false;
+		}
+	}
+	std::filesystem::remove(fileName);
+	AsyncWriter writer;
+	if (writer.open((std::filesystem::temp_directory_path()
+		/ "missing" / "directory.bin").string(), BUFFER_LENGTH,
+		SyncPolicy::NEVER)) {
+		std::cout << "A file in a missing directory was opened" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifySampler() {
+	const size_t SAMPLE_COUNT = 1 << 16;
+	const std::vector<uint64_t> BOUNDS = {
+		1, 2, 3, 7, 100, 129, 255, 256, 257, 65536, 65537, 1000000007,
+		1ULL << 32, (1ULL << 63) + 1, ~0ULL,
+	};
+	Jabberwock jabberwock;
+	jabberwock.seed(CHECK_SEEDS[0], 3);
+	Jabberwock reference;
+	jabberwock.clone(reference);
+	std::vector<uint8_t> bytes(8 * SAMPLE_COUNT);
+	reference.generate(bytes);
+	// Powers of 2 up to 2^64 never reject, so their draws are the PRNG's
+	// bytes themselves, most significant first.
+	Sampler sampler(&jabberwock);
+	size_t offset = 0;
+	for (size_t i = 0; i < SAMPLE_COUNT / 4; i++) {
+		// The operands of | are unsequenced, so the draws are made in order
+		// first.
+		uint64_t high = sampler.nextBelow(256);
+		uint64_t middle = sampler.nextBelow(65536);
+		uint64_t low = sampler.nextBelow(256);
+		uint64_t value = high << 24 | middle << 8 | low;
+		uint64_t expected = (uint64_t)bytes[offset] << 24
+			| (uint64_t)bytes[offset + 1] << 16
+			| (uint64_t)bytes[offset + 2] << 8 | bytes[offset + 3];
+		if (value != expected) {
+			std::cout << "Power of 2 bounds differ from the output"
+				<< std::endl;
+			return false;
+		}
+		offset += 4;
+	}
+	// Alphabets reject the bytes above their largest multiple, and floats
+	// and doubles take exactly 3 and 7 bytes.
+	for (size_t i = 0; i < SAMPLE_COUNT / 4; i++) {
+		uint64_t consumed = sampler.getConsumedBytes();
+		size_t index = sampler.nextIndex(10);
+		while (bytes[offset] >= 250) {
+			offset++;
+		}
+		if (index != bytes[offset++] % 10u
+			|| sampler.getConsumedBytes() != offset) {
+			std::cout << "Alphabet draws differ from the output" << std::endl;
+			return false;
+		}
+		consumed = sampler.getConsumedBytes();
+		float value = sampler.nextFloat(0.0f, 1.0f);
+		uint32_t fraction = (uint32_t)bytes[offset] << 16
+			| (uint32_t)bytes[offset + 1] << 8 | bytes[offset + 2];
+		offset += 3;
+		double value64 = sampler.nextDouble(-1.0, 1.0);
+		offset += 7;
+		if (value != std::ldexp((float)fraction, -24)
+			|| sampler.getConsumedBytes() != consumed + 10 || value64 < -1.0
+			|| value64 >= 1.0) {
+			std::cout << "Float draws differ from the output" << std::endl;
+			return false;
+		}
+	}
+	// Every bound keeps its draws below it, and small bounds spread them
+	// evenly, within a chi-squared bound far past any honest deviation.
+	for (uint64_t bound : BOUNDS) {
+		std::vector<size_t> counts(std::min(bound, (uint64_t)16), 0);
+		for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+			uint64_t value = sampler.nextBelow(bound);
+			if (value >= bound) {
+				std::cout << "A draw passed the bound " << bound << std::endl;
+				return false;
+			}
+			if (bound <= 16) {
+				counts[value]++;
+			}
+		}
+		if (bound <= 16 && bound > 1) {
+			double expected = (double)SAMPLE_COUNT / bound;
+			double chiSquared = 0.0;
+			for (size_t count : counts) {
+				chiSquared += (count - expected) * (count - expected)
+					/ expected;
+			}
+			if (chiSquared > 10.0 * bound + 50.0) {
+				std::cout << "Draws below " << bound << " are uneven"
+					<< std::endl;
+				return false;
+			}
+		}
+	}
+	for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+		int64_t value = sampler.nextInRange(-3, 3);
+		float single = sampler.nextFloat(-2.5f, 7.0f);
+		uint64_t consumed = sampler.getConsumedBytes();
+		sampler.nextInRange(INT64_MIN, INT64_MAX);
+		if (value < -3 || value > 3 || single < -2.5f || single >= 7.0f
+			|| sampler.getConsumedBytes() != consumed + 8
+			|| sampler.nextInRange(5, 5) != 5) {
+			std::cout << "A ranged draw left its range" << std::endl;
+			return false;
+		}
+	}
+	// Ranges wider than the largest float or double stay finite and spread
+	// their draws over the whole range rather than clamping to the bound.
+	std::set<float> singles;
+	std::set<double> doubles;
+	size_t negativeCount = 0;
+	for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+		float single = sampler.nextFloat(-3e38f, 3e38f);
+		double value64 = sampler.nextDouble(-DBL_MAX, DBL_MAX);
+		if (!std::isfinite(single) || single < -3e38f || single >= 3e38f
+			|| !std::isfinite(value64)) {
+			std::cout << "A wide ranged draw left its range" << std::endl;
+			return false;
+		}
+		singles.insert(single);
+		doubles.insert(value64);
+		negativeCount += single < 0.0f;
+	}
+	if (singles.size() < SAMPLE_COUNT / 2 || doubles.size() < SAMPLE_COUNT / 2
+		|| negativeCount < SAMPLE_COUNT / 4
+		|| negativeCount > SAMPLE_COUNT * 3 / 4) {
+		std::cout << "Wide ranged draws are uneven" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool verifyFormatPipeline() {
+	// Counts off the chunk and batch boundaries, with and without workers.
+	const std::vector<uint64_t> SYMBOL_COUNTS = {
+		0, 1, FORMAT_CHUNK_LENGTH - 1, 4 * FORMAT_CHUNK_LENGTH + 123,
+	};
+	std::string fileName = (std::filesystem::temp_directory_path()
+		/ "JabberwockFormatPipelineCheck.txt").string();
+	for (size_t workerCount : { 0, 3, }) {
+		FormatPipeline pipeline;
+		pipeline.start(workerCount);
+		for (uint64_t symbolCount : SYMBOL_COUNTS) {
+			// Integers and floats are formatted as an ostream prints them.
+			Jabberwock jabberwock;
+			jabberwock.seed(CHECK_SEEDS[1], 3);
+			Jabberwock reference;
+			jabberwock.clone(reference);
+			Sampler sampler(&jabberwock);
+			Sampler referenceSampler(&reference);
+			std::stringstream expected;
+			for (uint64_t i = 0; i < symbolCount; i++) {
+				expected << (int)referenceSampler.nextInRange(-1000000, 1000)
+					<< ", " << referenceSampler.nextFloat(-1e6f, 1e-3f) << "; ";
+			}
+			AsyncWriter writer;
+			writer.open(fileName, 1000, SyncPolicy::NEVER);
+			bool success = pipeline.run<std::pair<int, float>>(symbolCount,
+				48, writer, [&sampler]() {
+				int integer = (int)sampler.nextInRange(-1000000, 1000);
+				return std::make_pair(integer,
+					sampler.nextFloat(-1e6f, 1e-3f));
+			}, [](char* output, std::pair<int, float> symbol) {
+				output = std::to_chars(output, output + 11, symbol.first).ptr;
+				*output++ = ',';
+				*output++ = ' ';
+				output = std::to_chars(output, output + 16,
+					(double)symbol.second, std::chars_format::general, 6).ptr;
+				*output++ = ';';
+				*output++ = ' ';
+				return output;
+			}, nullptr);
+			success &= writer.close();
+			std::ifstream input(fileName, std::ios::binary);
+			std::string output((std::istreambuf_iterator<char>(input)),
+				std::istreambuf_iterator<char>());
+			input.close();
+			if (!success || output != expected.str()
+				|| sampler.getConsumedBytes()
+				!= referenceSampler.getConsumedBytes()) {
+				std::cout << symbolCount << " symbols with " << workerCount
+					<< " workers differ" << std::endl;
+				std::filesystem::remove(fileName);
+				return false;
+			}
+		}
+		pipeline.stop();
+	}
+	std::filesystem::remove(fileName);
+	return true;
+}
+
+bool verifyPackedFormat() {
+	// Ranges given as their element type, bounds and whether they are valid.
+	const std::vector<std::tuple<ElementType, std::string, std::string, bool>>
+		RANGES = {
+		{ ElementType::INT32, "-5", "5", true, },
+		{ ElementType::INT32, "0", "2147483648", false, },
+		{ ElementType::INT64, "0", "9223372036854775807", true, },
+		{ ElementType::INT64, "0", "99999999999999999999999", false, },
+		{ ElementType::INT64, "-99999999999999999999999", "0", false, },
+		{ ElementType::INT64, "5", "4", false, },
+		{ ElementType::INT64, "5", "", false, },
+		{ ElementType::FLOAT32, "-1e38", "3e38", true, },
+		{ ElementType::FLOAT32, "0", "1e39", false, },
+		{ ElementType::FLOAT32, "1e-46", "2e-46", false, },
+		{ ElementType::FLOAT64, "-1e308", "1e308", true, },
+		{ ElementType::FLOAT64, "0", "inf", false, },
+		{ ElementType::FLOAT64, "nan", "1", false, },
+		{ ElementType::FLOAT64, "0", "1e309", false, },
+		{ ElementType::FLOAT64, "1", "1", false, },
+		{ ElementType::FLOAT64, "1x", "2", false, },
+	};
+	const size_t ELEMENT_COUNT = 1000;
+	for (const std::tuple<ElementType, std::string, std::string, bool>& range
+		: RANGES) {
+		PackedFormat format = {};
+		format.type = std::get<0>(range);
+		if (parsePackedRange(format, std::get<1>(range), std::get<2>(range))
+			!= std::get<3>(range)) {
+			std::cout << "The range " << std::get<1>(range) << " to "
+				<< std::get<2>(range) << " was misjudged" << std::endl;
+			return false;
+		}
+	}
+	for (size_t type = 0; type < ELEMENT_TYPE_NAMES.size(); type++) {
+		PackedFormat format = {};
+		format.type = (ElementType)type;
+		bool integer = format.type == ElementType::INT32
+			|| format.type == ElementType::INT64;
+		parsePackedRange(format, integer ? "-1000" : "-2.5",
+			integer ? "1000" : "7");
+		// The header's length field counts the padded dictionary after it,
+		// and the elements start aligned.
+		std::string header = npyHeader(format, ELEMENT_COUNT);
+		size_t dictionaryLength = (uint8_t)header[NPY_MAGIC.length()]
+			| (size_t)(uint8_t)header[NPY_MAGIC.length() + 1] << 8;
+		if (header.compare(0, NPY_MAGIC.length(), NPY_MAGIC) != 0
+			|| header.length() % NPY_HEADER_ALIGNMENT != 0
+			|| NPY_MAGIC.length() + 2 + dictionaryLength != header.length()
+			|| header.back() != '\n'
+			|| header.find("'descr': '" + NPY_DESCRIPTORS[type] + "'")
+			== std::string::npos
+			|| header.find("'shape': (" + std::to_string(ELEMENT_COUNT)
+			+ ",)") == std::string::npos) {
+			std::cout << "The .npy header of " << ELEMENT_TYPE_NAMES[type]
+				<< " is malformed" << std::endl;
+			return false;
+		}
+		Jabberwock jabberwock;
+		jabberwock.seed(CHECK_SEEDS[0], 3);
+		Jabberwock reference;
+		jabberwock.clone(reference);
+		Sampler sampler(&jabberwock);
+		Sampler referenceSampler(&reference);
+		size_t elementSize = ELEMENT_SIZES[type];
+		std::vector<uint8_t> elements(ELEMENT_COUNT * elementSize);
+		drawPacked(sampler, format, elements.data(), ELEMENT_COUNT);
+		for (size_t i = 0; i < ELEMENT_COUNT; i++) {
+			uint64_t bits = 0;
+			for (size_t j = 0; j < elementSize; j++) {
+				bits |= (uint64_t)elements[i * elementSize + j] << (8 * j);
+			}
+			uint64_t expected = 0;
+			if (format.type == ElementType::INT32) {
+				expected = (uint32_t)referenceSampler.nextInRange(-1000, 1000);
+			}
+			else if (format.type == ElementType::INT64) {
+				expected = (uint64_t)referenceSampler.nextInRange(-1000, 1000);
+			}
+			else if (format.type == ElementType::FLOAT32) {
+				expected = std::bit_cast<uint32_t>(
+					referenceSampler.nextFloat(-2.5f, 7.0f));
+			}
+			else {
+				expected = std::bit_cast<uint64_t>(
+					referenceSampler.nextDouble(-2.5, 7.0));
+			}
+			if (bits != expected) {
+				std::cout << "Packed " << ELEMENT_TYPE_NAMES[type]
+					<< " elements differ from the sampler" << std::endl;
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/*
+Print the result of a verification check to the console.
+Parameter: const std::string& name - The name of the check.
+Parameter: bool passed - Whether the check passed.
+Returns: bool - Whether the check passed.
+*/
+static bool reportCheck(const std::string& name, bool passed) {
+	std::cout << name << ": " << (passed ? "passed" : "failed") << std::endl;
+	return passed;
+}
+
+bool runVerification() {
+	bool passed = true;
+	passed &= reportCheck("SHA-512 raw digest", verifySHA512Raw());
+	passed &= reportCheck("SHA-512 multi-buffer", verifySHA512Many());
+	passed &= reportCheck("String permutation", verifyPermuteString());
+	passed &= reportCheck("GLFSR byte kernel", verifyGLFSRKernel());
+	passed &= reportCheck("GLFSR jump", verifyGLFSRJump());
+	passed &= reportCheck("Fixed GLFSR", verifyFixedGLFSR());
+	passed &= reportCheck("Leaf bank", verifyLeafBank());
+	passed &= reportCheck("Node arena", verifyNodeArena());
+	passed &= reportCheck("Tree program", verifyTreeProgram());
+	passed &= reportCheck("Bulk generation", verifyBulkGenerate());
+	passed &= reportCheck("Parallel evaluation", verifyParallel());
+	passed &= reportCheck("Parallel seeding", verifyParallelSeeding());
+	passed &= reportCheck("Seek", verifySeek());
+	passed &= reportCheck("Snapshot", verifySnapshot());
+	passed &= reportCheck("Clone", verifyClone());
+	passed &= reportCheck("Substreams", verifySubstreams());
+	passed &= reportCheck("Prefetch buffer", verifyPrefetchBuffer());
+	passed &= reportCheck("Code generator", verifyCodeGenerator());
+	passed &= reportCheck("Tree statistics", verifyStatistics());
+	passed &= reportCheck("Asynchronous writer", verifyAsyncWriter());
+	passed &= reportCheck("Sampler", verifySampler());
+	passed &= reportCheck("Format pipeline", verifyFormatPipeline());
+	passed &= reportCheck("Packed format", verifyPackedFormat());
+	return passed;
+}
\ No newline at end of file
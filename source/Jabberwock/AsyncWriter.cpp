@@ -0,0 +1,199 @@
+/*
+File:		AsyncWriter.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@19:10
+Purpose:	Implement the AsyncWriter class functions found in AsyncWriter.h.
+*/
+
+#include "AsyncWriter.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#if defined(_MSC_VER)
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+// Implement AsyncWriter class functions.
+
+AsyncWriter::~AsyncWriter() {
+	close();
+}
+
+bool AsyncWriter::open(const std::string& fileName, size_t bufferLength,
+	SyncPolicy syncPolicy) {
+	close();
+	std::FILE* file = std::fopen(fileName.c_str(), "wb");
+	if (file == nullptr) {
+		return false;
+	}
+	start(file, true, bufferLength, syncPolicy);
+	return true;
+}
+
+bool AsyncWriter::open(std::FILE* file, size_t bufferLength,
+	SyncPolicy syncPolicy) {
+	close();
+	if (file == nullptr) {
+		return false;
+	}
+	start(file, false, bufferLength, syncPolicy);
+	return true;
+}
+
+uint8_t* AsyncWriter::getBuffer() {
+	return m_buffers[m_fillBuffer].data();
+}
+
+size_t AsyncWriter::getBufferLength() const {
+	return m_buffers[0].size();
+}
+
+bool AsyncWriter::submit(size_t length) {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_pendingLength == 0; });
+	if (length != 0) {
+		m_pendingLength = length;
+		m_fillBuffer ^= 1;
+		m_wake.notify_one();
+	}
+	m_fillLength = 0;
+	return !m_failed;
+}
+
+bool AsyncWriter::write(const void* data, size_t length) {
+	const uint8_t* bytes = (const uint8_t*)data;
+	bool success = true;
+	while (length > 0) {
+		size_t copyLength = std::min(length, getBufferLength() - m_fillLength);
+		std::memcpy(getBuffer() + m_fillLength, bytes, copyLength);
+		m_fillLength += copyLength;
+		bytes += copyLength;
+		length -= copyLength;
+		if (m_fillLength == getBufferLength()) {
+			success &= submit(m_fillLength);
+		}
+	}
+	return success;
+}
+
+bool AsyncWriter::close() {
+	if (!m_thread.joinable()) {
+		return !m_failed;
+	}
+	submit(m_fillLength);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_wake.notify_one();
+	m_thread.join();
+	// The I/O thread has exited, so the state is no longer shared.
+	if (std::fflush(m_file) != 0
+		|| (m_syncPolicy != SyncPolicy::NEVER && !sync())) {
+		recordError(errno);
+	}
+	if (m_ownsFile && std::fclose(m_file) != 0) {
+		recordError(errno);
+	}
+	m_file = nullptr;
+	m_buffers[0] = std::vector<uint8_t>();
+	m_buffers[1] = std::vector<uint8_t>();
+	return !m_failed;
+}
+
+uint64_t AsyncWriter::getWrittenBytes() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_writtenBytes;
+}
+
+int AsyncWriter::getError() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_error;
+}
+
+void AsyncWriter::start(std::FILE* file, bool ownsFile, size_t bufferLength,
+	SyncPolicy syncPolicy) {
+	m_file = file;
+	m_ownsFile = ownsFile;
+	m_syncPolicy = syncPolicy;
+#if defined(_MSC_VER)
+	struct _stat64 status;
+	m_syncable = _fstat64(_fileno(m_file), &status) == 0
+		&& (status.st_mode & _S_IFMT) == _S_IFREG;
+#else
+	struct stat status;
+	m_syncable = fstat(fileno(m_file), &status) == 0
+		&& S_ISREG(status.st_mode);
+#endif
+	// Buffers are written whole, so the file's own buffering would only add a
+	// copy.
+	std::setvbuf(m_file, nullptr, _IONBF, 0);
+	m_buffers[0].assign(std::max(bufferLength, (size_t)1), 0);
+	m_buffers[1].assign(std::max(bufferLength, (size_t)1), 0);
+	m_fillBuffer = 0;
+	m_fillLength = 0;
+	m_pendingLength = 0;
+	m_stopping = false;
+	m_failed = false;
+	m_error = 0;
+	m_writtenBytes = 0;
+	m_thread = std::thread(&AsyncWriter::flush, this);
+}
+
+void AsyncWriter::flush() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true) {
+		m_wake.wait(lock, [this]() {
+			return m_pendingLength != 0 || m_stopping;
+		});
+		if (m_pendingLength == 0) {
+			return;
+		}
+		// The pending buffer is the one the producer is not filling, and it
+		// is not touched again until the write finishes.
+		const uint8_t* buffer = m_buffers[m_fillBuffer ^ 1].data();
+		size_t length = m_pendingLength;
+		lock.unlock();
+		size_t written = std::fwrite(buffer, 1, length, m_file);
+		bool success = written == length;
+		if (success && m_syncPolicy == SyncPolicy::EVERY_BUFFER) {
+			success = sync();
+		}
+		int error = success ? 0 : errno;
+		lock.lock();
+		if (!success) {
+			recordError(error);
+		}
+		m_writtenBytes += written;
+		m_pendingLength = 0;
+		m_done.notify_one();
+	}
+}
+
+void AsyncWriter::recordError(int error) {
+	if (!m_failed) {
+		m_error = error;
+	}
+	m_failed = true;
+}
+
+bool AsyncWriter::sync() {
+	if (std::fflush(m_file) != 0) {
+		return false;
+	}
+	if (!m_syncable) {
+		return true;
+	}
+#if defined(_MSC_VER)
+	return _commit(_fileno(m_file)) == 0;
+#else
+	return fsync(fileno(m_file)) == 0;
+#endif
+}
@@ -0,0 +1,280 @@
+/*
+File:		CodeGenerator.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@18:25
+Purpose:	Implement the CodeGenerator class functions found in
+			CodeGenerator.h.
+*/
+
+#include "CodeGenerator.h"
+
+#include <cctype>
+#include <vector>
+
+// Implement CodeGenerator module functions.
+
+// The number of state words on each line of the generated state array.
+const static size_t STATE_WORDS_PER_LINE = 3;
+// The C++ operators of the gate types.
+const static std::string GATE_OPERATORS[3] = { "^", "&", "|", };
+// The column which generated lines are wrapped at, counting a tab as 4.
+const static size_t WRAP_COLUMN = 80;
+
+/*
+Format a 64-bit word as a C++ hexadecimal literal.
+Parameter: uint64_t word - The word to format.
+Returns: std::string - The literal, with all 16 digits and a ULL suffix.
+*/
+static std::string hexLiteral(uint64_t word) {
+	std::string literal = "0x";
+	for (int shift = 60; shift >= 0; shift -= 4) {
+		literal += HEX_CHARACTERS[(word >> shift) & 0x0F];
+	}
+	return literal + "ULL";
+}
+
+/*
+Check whether a name is a C++ identifier.
+Parameter: const std::string& name - The name to check.
+Returns: bool - Whether the name is non-empty, starts with a letter or an
+underscore and has only letters, digits and underscores.
+*/
+static bool isIdentifier(const std::string& name) {
+	if (name.empty() || std::isdigit((unsigned char)name[0])) {
+		return false;
+	}
+	for (char character : name) {
+		if (!std::isalnum((unsigned char)character) && character != '_') {
+			return false;
+		}
+	}
+	return true;
+}
+
+/*
+Write a statement of generated code inside a function, wrapped before an
+operator where it would pass WRAP_COLUMN, with its continuation lines indented
+once more.
+Parameter: std::ostream& output - The stream to write to.
+Parameter: const std::string& start - The statement up to its first term.
+Parameter: const std::vector<std::string>& terms - The terms of the statement.
+Parameter: const std::string& separator - The operator between the terms.
+Parameter: const std::string& end - The statement after its last term.
+*/
+static void writeStatement(std::ostream& output, const std::string& start,
+	const std::vector<std::string>& terms, const std::string& separator,
+	const std::string& end) {
+	std::string line = "\t\t" + start + terms[0];
+	size_t column = 8 + start.length() + terms[0].length();
+	for (size_t i = 1; i < terms.size(); i++) {
+		std::string term = separator + " " + terms[i];
+		size_t tail = i + 1 == terms.size() ? end.length() : 0;
+		if (column + 1 + term.length() + tail > WRAP_COLUMN) {
+			output << line << "\n";
+			line = "\t\t\t" + term;
+			column = 12 + term.length();
+		}
+		else {
+			line += " " + term;
+			column += 1 + term.length();
+		}
+	}
+	output << line << end << "\n";
+}
+
+/*
+Write the step function of a GLFSR configuration: the byte-wide GLFSR step
+with the configuration's shifts, top mask and taps as constants. The feedback
+of an output byte is the byte shifted up to each tap, which is the entry of
+the configuration's feedback table without the table.
+Parameter: std::ostream& output - The stream to write to.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+*/
+static void writeStepFunction(std::ostream& output, size_t config) {
+	size_t length = GLFSR_CONFIGS[config][0];
+	size_t topWord = (length - 1) / 64;
+	size_t outputWord = (length - 8) / 64;
+	size_t outputShift = (length - 8) % 64;
+	std::string topMask = length % 64 == 0 ? ""
+		: hexLiteral((1ULL << (length % 64)) - 1);
+	output << "\t/*\n\tAdvance a " << length << "-bit GLFSR by a byte.\n"
+		<< "\tParameter: uint64_t* state - The state words of the GLFSR.\n"
+		<< "\tReturns: uint8_t - The byte shifted out of the GLFSR.\n\t*/\n"
+		<< "\tstatic uint8_t step" << config << "(uint64_t* state) {\n"
+		<< "\t\tuint8_t byte = (uint8_t)(state[" << outputWord << "] >> "
+		<< outputShift;
+	if (outputShift > 56) {
+		output << " | state[" << outputWord + 1 << "] << "
+			<< 64 - outputShift;
+	}
+	output << ");\n";
+	for (size_t i = topWord; i > 0; i--) {
+		std::string word = "state[" + std::to_string(i) + "]";
+		std::string shifted = "(" + word + " << 8) | (state["
+			+ std::to_string(i - 1) + "] >> 56)";
+		if (i == topWord && !topMask.empty()) {
+			writeStatement(output, word + " = ", { "(" + shifted + ")",
+				topMask, }, "&", ";");
+		}
+		else {
+			writeStatement(output, word + " = ", { shifted, }, "", ";");
+		}
+	}
+	std::vector<std::string> terms = { topWord == 0 && !topMask.empty()
+		? "((state[0] << 8) & " + topMask + ")" : "(state[0] << 8)", };
+	for (size_t i = 1; i < GLFSR_CONFIGS[config].size(); i++) {
+		size_t tap = length - GLFSR_CONFIGS[config][i];
+		terms.push_back(tap == 0 ? "(uint64_t)byte"
+			: "((uint64_t)byte << " + std::to_string(tap) + ")");
+	}
+	writeStatement(output, "state[0] = ", terms, "^", ";");
+	output << "\t\treturn byte;\n\t}\n";
+}
+
+// Implement CodeGenerator class functions.
+
+bool CodeGenerator::addSubtree(const LeafBank& bank,
+	const TreeProgram& program) {
+	if (!program.isCompiled()) {
+		return false;
+	}
+	Subtree subtree;
+	subtree.gates.resize(bank.getOutputCount());
+	std::vector<bool> isGate(subtree.gates.size(), false);
+	for (size_t type = 0; type < 3; type++) {
+		for (size_t i = 0; i < bank.getGateCount((NodeType)type); i++) {
+			size_t index = bank.getOutputIndex((NodeType)type, i);
+			subtree.gates[index].type = (NodeType)type;
+			isGate[index] = true;
+		}
+	}
+	// Each gate's GLFSRs are placed by their positions in its slot, and the
+	// padding lanes, which write to a slot of no gate, are dropped.
+	for (const LeafBank::Group& group : bank.getGroups()) {
+		for (size_t lane = 0; lane < group.laneCount; lane++) {
+			size_t slot = group.destinations[lane] / 8;
+			size_t position = group.destinations[lane] % 8;
+			if (!isGate[slot]) {
+				continue;
+			}
+			Gate& gate = subtree.gates[slot];
+			if (gate.leaves.size() <= position) {
+				gate.leaves.resize(position + 1);
+			}
+			gate.leaves[position] = m_leaves.size();
+			m_leaves.push_back({ group.config, m_state.size(), });
+			for (size_t i = 0; i < group.wordCount; i++) {
+				m_state.push_back(group.state[i * group.laneCount + lane]);
+			}
+		}
+	}
+	subtree.instructions = program.getInstructions();
+	m_subtrees.push_back(std::move(subtree));
+	return true;
+}
+
+bool CodeGenerator::write(std::ostream& output, const std::string& className,
+	uint64_t position) const {
+	if (m_subtrees.empty() || !isIdentifier(className)) {
+		return false;
+	}
+	std::string guard = "JABBERWOCK_GENERATED_";
+	for (char character : className) {
+		guard += (char)std::toupper((unsigned char)character);
+	}
+	size_t gateCount = 0;
+	for (const Subtree& subtree : m_subtrees) {
+		for (const Gate& gate : subtree.gates) {
+			gateCount += gate.leaves.empty() ? 0 : 1;
+		}
+	}
+	output << "/*\nFile:\t\t" << className << ".h\nPurpose:\tA seeded "
+		<< "Jabberwock PRNG tree written out as straight-line code by\n\t\t\t"
+		<< "the Jabberwock code generator: " << m_leaves.size()
+		<< " GLFSRs under " << gateCount << " gates in\n\t\t\t"
+		<< m_subtrees.size() << " subtrees, starting at byte " << position
+		<< " of the output.\n"
+		<< "*/\n\n#ifndef " << guard << "_H\n#define " << guard << "_H\n\n"
+		<< "#include <cstddef>\n#include <cstdint>\n\n"
+		<< "// A Jabberwock PRNG with a fixed seed.\nclass " << className
+		<< " {\npublic:\n"
+		<< "\t// The offset in the PRNG's output of this generator's first "
+		<< "byte.\n\tconstexpr static uint64_t START_POSITION = " << position
+		<< "ULL;\n\n";
+	output << "\t/*\n\tGet a pseudo-random byte of output from the PRNG.\n"
+		<< "\tReturns: uint8_t - A pseudo-random byte.\n\t*/\n"
+		<< "\tuint8_t generate() {\n\t\tm_position++;\n";
+	std::vector<std::string> roots;
+	for (size_t s = 0; s < m_subtrees.size(); s++) {
+		const Subtree& subtree = m_subtrees[s];
+		std::string prefix = std::to_string(s) + "_";
+		for (size_t g = 0; g < subtree.gates.size(); g++) {
+			const Gate& gate = subtree.gates[g];
+			if (gate.leaves.empty()) {
+				continue;
+			}
+			std::vector<std::string> terms;
+			for (size_t leaf : gate.leaves) {
+				terms.push_back("step" + std::to_string(m_leaves[leaf].config)
+					+ "(m_state + " + std::to_string(m_leaves[leaf].offset)
+					+ ")");
+			}
+			writeStatement(output, "uint8_t g" + prefix + std::to_string(g)
+				+ " = (uint8_t)(", terms, GATE_OPERATORS[(size_t)gate.type],
+				");");
+		}
+		// LOAD instructions read their gate's variable directly, and every
+		// other instruction gets a variable of its own.
+		std::vector<std::string> results(subtree.instructions.size());
+		for (size_t i = 0; i < subtree.instructions.size(); i++) {
+			const TreeProgram::Instruction& instruction
+				= subtree.instructions[i];
+			if (instruction.op == TreeOperation::LOAD) {
+				results[i] = "g" + prefix + std::to_string(instruction.first);
+				continue;
+			}
+			results[i] = "r" + prefix + std::to_string(i);
+			writeStatement(output, "uint8_t " + results[i] + " = (uint8_t)(",
+				std::vector<std::string>(results.begin() + instruction.first,
+				results.begin() + instruction.first + instruction.count),
+				GATE_OPERATORS[(size_t)instruction.op - 1], ");");
+		}
+		roots.push_back(results.back());
+	}
+	writeStatement(output, "return (uint8_t)(", roots, "^", ");");
+	output << "\t}\n"
+		<< "\t/*\n\tFill a buffer with pseudo-random bytes from the PRNG.\n"
+		<< "\tParameter: uint8_t* output - The buffer to fill.\n"
+		<< "\tParameter: size_t length - The number of bytes to generate.\n"
+		<< "\t*/\n\tvoid generate(uint8_t* output, size_t length) {\n"
+		<< "\t\tfor (size_t i = 0; i < length; i++) {\n"
+		<< "\t\t\toutput[i] = generate();\n\t\t}\n\t}\n"
+		<< "\t/*\n\tGet the PRNG's offset in its output.\n"
+		<< "\tReturns: uint64_t - The offset of the next byte to be generated."
+		<< "\n\t*/\n\tuint64_t getPosition() const {\n"
+		<< "\t\treturn m_position;\n\t}\n\nprivate:\n";
+	std::vector<bool> used(GLFSR_CONFIGS.size(), false);
+	for (const Leaf& leaf : m_leaves) {
+		used[leaf.config] = true;
+	}
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		if (used[config]) {
+			writeStepFunction(output, config);
+		}
+	}
+	output << "\n\t// The state words of the GLFSRs.\n\tuint64_t m_state["
+		<< m_state.size() << "] = {";
+	for (size_t i = 0; i < m_state.size(); i++) {
+		output << (i % STATE_WORDS_PER_LINE == 0 ? "\n\t\t" : " ")
+			<< hexLiteral(m_state[i]) << ",";
+	}
+	output << "\n\t};\n\t// The offset of the next byte to be generated.\n"
+		<< "\tuint64_t m_position = START_POSITION;\n};\n\n#endif\n";
+	return (bool)output;
+}
+
+void CodeGenerator::clear() {
+	m_leaves.clear();
+	m_state.clear();
+	m_subtrees.clear();
+}
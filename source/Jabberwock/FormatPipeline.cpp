@@ -0,0 +1,21 @@
+/*
+File:		FormatPipeline.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@20:20
+Purpose:	Implement the FormatPipeline class functions found in
+			FormatPipeline.h.
+*/
+
+#include "FormatPipeline.h"
+
+// Implement FormatPipeline class functions.
+
+void FormatPipeline::start(size_t workerCount) {
+	m_pool.start(workerCount);
+}
+
+void FormatPipeline::stop() {
+	m_pool.stop();
+	m_chunks.clear();
+	m_chunkLengths.clear();
+}
@@ -0,0 +1,360 @@
+/*
+File:		GLFSR.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@09:12
+Purpose:	Implement the GLFSR class functions found in GLFSR.h.
+*/
+
+#include "GLFSR.h"
+
+#include <type_traits>
+#include <utility>
+
+// Implement GLFSR module functions.
+
+/*
+Compute the carry-less product of two 64-bit words, 4 bits at a time.
+Parameter: uint64_t a - The first word.
+Parameter: uint64_t b - The second word.
+Parameter: uint64_t& low - Set to the low word of the product.
+Parameter: uint64_t& high - Set to the high word of the product.
+*/
+static void multiplyWords(uint64_t a, uint64_t b, uint64_t& low,
+	uint64_t& high) {
+	uint64_t multiplesLow[16];
+	uint64_t multiplesHigh[16];
+	multiplesLow[0] = 0;
+	multiplesHigh[0] = 0;
+	for (size_t i = 1; i < 16; i++) {
+		if (i % 2 == 0) {
+			multiplesLow[i] = multiplesLow[i / 2] << 1;
+			multiplesHigh[i] = (multiplesHigh[i / 2] << 1)
+				| (multiplesLow[i / 2] >> 63);
+		}
+		else {
+			multiplesLow[i] = multiplesLow[i - 1] ^ a;
+			multiplesHigh[i] = multiplesHigh[i - 1];
+		}
+	}
+	low = 0;
+	high = 0;
+	for (size_t i = 0; i < 16; i++) {
+		high = (high << 4) | (low >> 60);
+		low <<= 4;
+		size_t nibble = (size_t)((b >> (60 - 4 * i)) & 0x0F);
+		low ^= multiplesLow[nibble];
+		high ^= multiplesHigh[nibble];
+	}
+}
+
+/*
+Spread the bits of a 32-bit word over the even bits of a 64-bit word, which
+squares it as a polynomial over GF(2).
+Parameter: uint32_t word - The word to spread.
+Returns: uint64_t - The spread word.
+*/
+static uint64_t spreadBits(uint32_t word) {
+	uint64_t spread = word;
+	spread = (spread | (spread << 16)) & 0x0000FFFF0000FFFFULL;
+	spread = (spread | (spread << 8)) & 0x00FF00FF00FF00FFULL;
+	spread = (spread | (spread << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	spread = (spread | (spread << 2)) & 0x3333333333333333ULL;
+	spread = (spread | (spread << 1)) & 0x5555555555555555ULL;
+	return spread;
+}
+
+/*
+Reverse the order of the bits of a byte.
+Parameter: uint8_t byte - The byte to reverse.
+Returns: uint8_t - The reversed byte.
+*/
+static uint8_t reverseBits(uint8_t byte) {
+	byte = (uint8_t)((byte >> 4) | (byte << 4));
+	byte = (uint8_t)(((byte & 0xCC) >> 2) | ((byte & 0x33) << 2));
+	byte = (uint8_t)(((byte & 0xAA) >> 1) | ((byte & 0x55) << 1));
+	return byte;
+}
+
+/*
+Reduce a polynomial over GF(2) modulo the characteristic polynomial of a GLFSR
+configuration, x^length plus the sum of x^tap over its taps. The terms at and
+above x^length are folded back down by x^length = sum of x^tap until none are
+left.
+Parameter: std::vector<uint64_t>& polynomial - The polynomial to reduce, with
+room for its highest term shifted up by the highest tap; resized to the
+configuration's state word count.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+*/
+static void reducePolynomial(std::vector<uint64_t>& polynomial, size_t config) {
+	size_t length = GLFSR_CONFIGS[config][0];
+	size_t wordCount = (length + 63) / 64;
+	size_t topShift = length % 64;
+	std::vector<uint64_t> high(polynomial.size());
+	while (true) {
+		bool reduced = true;
+		for (size_t i = length / 64; i < polynomial.size(); i++) {
+			uint64_t word = polynomial[i];
+			if (i == length / 64) {
+				word = topShift == 0 ? word : word >> topShift;
+			}
+			if (word != 0) {
+				reduced = false;
+				break;
+			}
+		}
+		if (reduced) {
+			break;
+		}
+		for (size_t i = 0; i < high.size(); i++) {
+			size_t source = i + length / 64;
+			uint64_t word = 0;
+			if (source < polynomial.size()) {
+				word = topShift == 0 ? polynomial[source]
+					: polynomial[source] >> topShift;
+			}
+			if (topShift != 0 && source + 1 < polynomial.size()) {
+				word |= polynomial[source + 1] << (64 - topShift);
+			}
+			high[i] = word;
+		}
+		for (size_t i = length / 64; i < polynomial.size(); i++) {
+			if (i == length / 64 && topShift != 0) {
+				polynomial[i] &= (1ULL << topShift) - 1;
+			}
+			else {
+				polynomial[i] = 0;
+			}
+		}
+		for (size_t i = 1; i < GLFSR_CONFIGS[config].size(); i++) {
+			size_t tap = length - GLFSR_CONFIGS[config][i];
+			size_t wordShift = tap / 64;
+			size_t bitShift = tap % 64;
+			for (size_t j = 0; j + wordShift < polynomial.size()
+				&& j < high.size(); j++) {
+				polynomial[j + wordShift] ^= high[j] << bitShift;
+				if (bitShift != 0 && j + wordShift + 1 < polynomial.size()) {
+					polynomial[j + wordShift + 1] ^= high[j]
+						>> (64 - bitShift);
+				}
+			}
+		}
+	}
+	polynomial.resize(wordCount);
+}
+
+/*
+Multiply two polynomials over GF(2) modulo the characteristic polynomial of a
+GLFSR configuration.
+Parameter: const std::vector<uint64_t>& a - The first polynomial.
+Parameter: const std::vector<uint64_t>& b - The second polynomial.
+Parameter: size_t config - The index of the configuration in GLFSR_CONFIGS.
+Returns: std::vector<uint64_t> - The reduced product.
+*/
+static std::vector<uint64_t> multiplyPolynomials(const std::vector<uint64_t>& a,
+	const std::vector<uint64_t>& b, size_t config) {
+	std::vector<uint64_t> product(a.size() + b.size() + 1, 0);
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i] == 0) {
+			continue;
+		}
+		for (size_t j = 0; j < b.size(); j++) {
+			uint64_t low = 0;
+			uint64_t high = 0;
+			multiplyWords(a[i], b[j], low, high);
+			product[i + j] ^= low;
+			product[i + j + 1] ^= high;
+		}
+	}
+	reducePolynomial(product, config);
+	return product;
+}
+
+std::vector<uint64_t> GLFSRJumpPolynomial(size_t config, uint64_t steps) {
+	size_t wordCount = (GLFSR_CONFIGS[config][0] + 63) / 64;
+	std::vector<uint64_t> polynomial(wordCount, 0);
+	polynomial[0] = 1;
+	std::vector<uint64_t> square(2 * wordCount + 1);
+	for (size_t bit = 64; bit > 0; bit--) {
+		if (steps >> (bit - 1) == 0) {
+			continue;
+		}
+		square.assign(2 * wordCount + 1, 0);
+		for (size_t i = 0; i < wordCount; i++) {
+			square[2 * i] = spreadBits((uint32_t)polynomial[i]);
+			square[2 * i + 1] = spreadBits((uint32_t)(polynomial[i] >> 32));
+		}
+		if ((steps >> (bit - 1)) & 0x01) {
+			for (size_t i = square.size() - 1; i > 0; i--) {
+				square[i] = (square[i] << 1) | (square[i - 1] >> 63);
+			}
+			square[0] <<= 1;
+		}
+		reducePolynomial(square, config);
+		polynomial = square;
+	}
+	return polynomial;
+}
+
+void GLFSRApplyJump(size_t config, uint64_t* state,
+	const std::vector<uint64_t>& jumpPolynomial) {
+	size_t wordCount = (GLFSR_CONFIGS[config][0] + 63) / 64;
+	std::vector<uint64_t> product = multiplyPolynomials(
+		std::vector<uint64_t>(state, state + wordCount), jumpPolynomial,
+		config);
+	for (size_t i = 0; i < wordCount; i++) {
+		state[i] = product[i];
+	}
+}
+
+/*
+Build a table with an entry per alternative of FixedGLFSRVariant, in
+configuration order.
+Template: typename Entry - The type of the table's entries.
+Template: typename Build - The function template object which makes the entry
+of an alternative, given a pointer to it as a type tag.
+Template: size_t... Configs - The indices of the alternatives.
+Parameter: Build build - The entry function.
+Returns: std::array<Entry, sizeof...(Configs)> - The table.
+*/
+template <typename Entry, typename Build, size_t... Configs>
+constexpr std::array<Entry, sizeof...(Configs)> buildFixedGLFSRTable(
+	Build build, std::index_sequence<Configs...>) {
+	return { build((std::variant_alternative_t<Configs, FixedGLFSRVariant>*)
+		nullptr)... };
+}
+
+const uint64_t* GLFSRFeedbackTable(size_t config) {
+	constexpr static std::array<const uint64_t*,
+		std::variant_size_v<FixedGLFSRVariant>> FEEDBACK_TABLES
+		= buildFixedGLFSRTable<const uint64_t*>([](auto* fixed) {
+			using Fixed = std::remove_pointer_t<decltype(fixed)>;
+			return Fixed::BYTE_STEP ? Fixed::FEEDBACK_TABLE.data()
+				: (const uint64_t*)nullptr;
+		}, std::make_index_sequence<std::variant_size_v<FixedGLFSRVariant>>());
+	return FEEDBACK_TABLES[config];
+}
+
+FixedGLFSRVariant makeFixedGLFSR(size_t config) {
+	constexpr static std::array<FixedGLFSRVariant(*)(),
+		std::variant_size_v<FixedGLFSRVariant>> CONSTRUCTORS
+		= buildFixedGLFSRTable<FixedGLFSRVariant(*)()>([](auto* fixed) {
+			using Fixed = std::remove_pointer_t<decltype(fixed)>;
+			return +[]() { return FixedGLFSRVariant(Fixed()); };
+		}, std::make_index_sequence<std::variant_size_v<FixedGLFSRVariant>>());
+	return CONSTRUCTORS[config]();
+}
+
+void GLFSRFillState(const SHA512Digest& stateDigest, uint64_t* state,
+	size_t wordCount, uint64_t topMask) {
+	uint64_t digestWords[SHA512_DIGEST_LENGTH / 8];
+	for (size_t i = 0; i < SHA512_DIGEST_LENGTH / 8; i++) {
+		digestWords[i] = 0;
+		for (size_t j = 0; j < 8; j++) {
+			digestWords[i] |= (uint64_t)reverseBits(stateDigest[i * 8 + j])
+				<< (8 * j);
+		}
+	}
+	for (size_t i = 0; i < wordCount; i++) {
+		state[i] = digestWords[i % (SHA512_DIGEST_LENGTH / 8)];
+	}
+	state[wordCount - 1] &= topMask;
+}
+
+// Implement GLFSR class functions.
+
+GLFSR::GLFSR(std::pmr::memory_resource* resource) : m_state(resource),
+	m_taps(resource) {}
+
+void GLFSR::seed(size_t config, const SHA512Digest& stateDigest) {
+	m_config = config;
+	m_length = GLFSR_CONFIGS[config][0];
+	size_t wordCount = (m_length + 63) / 64;
+	size_t topBits = m_length - (wordCount - 1) * 64;
+	m_topMask = topBits == 64 ? ~0ULL : (1ULL << topBits) - 1;
+	m_state.resize(wordCount);
+	GLFSRFillState(stateDigest, m_state.data(), wordCount, m_topMask);
+	m_taps.clear();
+	for (size_t i = 1; i < GLFSR_CONFIGS[config].size(); i++) {
+		size_t tap = m_length - GLFSR_CONFIGS[config][i];
+		if (m_taps.size() <= tap / 64) {
+			m_taps.resize(tap / 64 + 1, 0);
+		}
+		m_taps[tap / 64] |= 1ULL << (tap % 64);
+	}
+	m_feedback = GLFSRFeedbackTable(config);
+}
+
+bool GLFSR::step() {
+	size_t topWord = m_state.size() - 1;
+	bool outputBit = (bool)((m_state[topWord] >> ((m_length - 1) % 64)) & 0x01);
+	for (size_t i = topWord; i > 0; i--) {
+		m_state[i] = (m_state[i] << 1) | (m_state[i - 1] >> 63);
+	}
+	m_state[0] <<= 1;
+	m_state[topWord] &= m_topMask;
+	if (outputBit) {
+		for (size_t i = 0; i < m_taps.size(); i++) {
+			m_state[i] ^= m_taps[i];
+		}
+	}
+	return outputBit;
+}
+
+uint8_t GLFSR::generate() {
+	if (m_feedback == nullptr) {
+		return generateSerial();
+	}
+	size_t topWord = m_state.size() - 1;
+	size_t outputIndex = m_length - 8;
+	size_t outputWord = outputIndex / 64;
+	size_t outputShift = outputIndex % 64;
+	uint64_t outputBits = m_state[outputWord] >> outputShift;
+	if (outputShift > 56) {
+		outputBits |= m_state[outputWord + 1] << (64 - outputShift);
+	}
+	uint8_t byte = (uint8_t)outputBits;
+	for (size_t i = topWord; i > 0; i--) {
+		m_state[i] = (m_state[i] << 8) | (m_state[i - 1] >> 56);
+	}
+	m_state[0] <<= 8;
+	m_state[topWord] &= m_topMask;
+	m_state[0] ^= m_feedback[byte];
+	return byte;
+}
+
+uint8_t GLFSR::generateSerial() {
+	uint8_t byte = 0x00;
+	for (size_t bit = 0; bit < 8; bit++) {
+		byte <<= 1;
+		byte |= (uint8_t)step();
+	}
+	return byte;
+}
+
+void GLFSR::jump(uint64_t steps) {
+	applyJump(GLFSRJumpPolynomial(m_config, steps));
+}
+
+void GLFSR::applyJump(const std::vector<uint64_t>& jumpPolynomial) {
+	GLFSRApplyJump(m_config, m_state.data(), jumpPolynomial);
+}
+
+void GLFSR::clear() {
+	for (size_t i = 0; i < m_state.size(); i++) {
+		m_state[i] = 0;
+	}
+	m_state.clear();
+	m_taps.clear();
+	m_feedback = nullptr;
+	m_config = 0;
+	m_length = 0;
+	m_topMask = 0;
+}
+
+size_t GLFSR::getConfig() const {
+	return m_config;
+}
+
+const std::pmr::vector<uint64_t>& GLFSR::getState() const {
+	return m_state;
+}
\ No newline at end of file
@@ -0,0 +1,359 @@
+/*
+File:		Hash.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@16:02
+Purpose:	Implement the functions found in Hash.h.
+*/
+
+#include "Hash.h"
+
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#define JABBERWOCK_X64
+#if defined(_MSC_VER)
+#define JABBERWOCK_TARGET_AVX2
+#else
+#define JABBERWOCK_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Implement Hash module functions.
+
+// The number of bytes in a SHA-512 message block.
+const static size_t SHA512_BLOCK_LENGTH = 128;
+// The initial hash value of SHA-512.
+const static uint64_t SHA512_INITIAL_HASH[8] = {
+	0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+	0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+	0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL,
+};
+// The round constants of SHA-512.
+const static uint64_t SHA512_ROUND_CONSTANTS[80] = {
+	0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+	0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+	0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+	0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+	0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+	0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+	0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+	0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+	0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+	0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+	0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+	0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+	0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+	0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+	0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+	0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+	0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+	0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+	0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+	0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+	0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+	0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+	0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+	0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+	0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+	0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+	0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL,
+};
+
+/*
+Rotate a 64-bit word right.
+Parameter: uint64_t word - The word to rotate.
+Parameter: unsigned int count - The number of bits to rotate by, from 1 to 63.
+Returns: uint64_t - The rotated word.
+*/
+static inline uint64_t rotateRight(uint64_t word, unsigned int count) {
+	return (word >> count) | (word << (64 - count));
+}
+
+/*
+Process a message block into a SHA-512 hash value.
+Parameter: uint64_t* hash - The 8 words of the hash value to update.
+Parameter: const uint8_t* block - The 128-byte message block.
+*/
+static void compressBlock(uint64_t* hash, const uint8_t* block) {
+	uint64_t schedule[80];
+	for (size_t t = 0; t < 16; t++) {
+		uint64_t word = 0;
+		for (size_t j = 0; j < 8; j++) {
+			word = (word << 8) | block[t * 8 + j];
+		}
+		schedule[t] = word;
+	}
+	for (size_t t = 16; t < 80; t++) {
+		uint64_t s0 = rotateRight(schedule[t - 15], 1)
+			^ rotateRight(schedule[t - 15], 8) ^ (schedule[t - 15] >> 7);
+		uint64_t s1 = rotateRight(schedule[t - 2], 19)
+			^ rotateRight(schedule[t - 2], 61) ^ (schedule[t - 2] >> 6);
+		schedule[t] = schedule[t - 16] + s0 + schedule[t - 7] + s1;
+	}
+	uint64_t a = hash[0];
+	uint64_t b = hash[1];
+	uint64_t c = hash[2];
+	uint64_t d = hash[3];
+	uint64_t e = hash[4];
+	uint64_t f = hash[5];
+	uint64_t g = hash[6];
+	uint64_t h = hash[7];
+	for (size_t t = 0; t < 80; t++) {
+		uint64_t t1 = h + (rotateRight(e, 14) ^ rotateRight(e, 18)
+			^ rotateRight(e, 41)) + ((e & f) ^ (~e & g))
+			+ SHA512_ROUND_CONSTANTS[t] + schedule[t];
+		uint64_t t2 = (rotateRight(a, 28) ^ rotateRight(a, 34)
+			^ rotateRight(a, 39)) + ((a & b) ^ (a & c) ^ (b & c));
+		h = g;
+		g = f;
+		f = e;
+		e = d + t1;
+		d = c;
+		c = b;
+		b = a;
+		a = t1 + t2;
+	}
+	hash[0] += a;
+	hash[1] += b;
+	hash[2] += c;
+	hash[3] += d;
+	hash[4] += e;
+	hash[5] += f;
+	hash[6] += g;
+	hash[7] += h;
+}
+
+/*
+Pad the end of a message which does not fill a whole block with a 1 bit, zeros
+and the 128-bit message length, which takes one or two blocks.
+Parameter: const uint8_t* input - The message.
+Parameter: size_t length - The number of bytes in the message.
+Parameter: uint8_t* tail - The buffer of 2 blocks to fill with the padded end
+of the message.
+Returns: size_t - The number of padded blocks.
+*/
+static size_t padTail(const uint8_t* input, size_t length, uint8_t* tail) {
+	size_t fullLength = length - length % SHA512_BLOCK_LENGTH;
+	size_t tailLength = length - fullLength;
+	std::memset(tail, 0, 2 * SHA512_BLOCK_LENGTH);
+	if (tailLength > 0) {
+		std::memcpy(tail, input + fullLength, tailLength);
+	}
+	tail[tailLength] = 0x80;
+	size_t tailBlocks = tailLength + 17 > SHA512_BLOCK_LENGTH ? 2 : 1;
+	uint8_t* lengthEnd = tail + tailBlocks * SHA512_BLOCK_LENGTH;
+	uint64_t bitLength = (uint64_t)length << 3;
+	for (size_t i = 0; i < 8; i++) {
+		lengthEnd[-1 - (ptrdiff_t)i] = (uint8_t)(bitLength >> (8 * i));
+	}
+	lengthEnd[-9] = (uint8_t)((uint64_t)length >> 61);
+	return tailBlocks;
+}
+
+/*
+Write the words of a SHA-512 hash value out as a digest.
+Parameter: const uint64_t* hash - The 8 words of the hash value.
+Parameter: SHA512Digest& digest - The digest to fill.
+*/
+static void storeDigest(const uint64_t* hash, SHA512Digest& digest) {
+	for (size_t i = 0; i < 8; i++) {
+		for (size_t j = 0; j < 8; j++) {
+			digest[i * 8 + j] = (uint8_t)(hash[i] >> (56 - 8 * j));
+		}
+	}
+}
+
+#if defined(JABBERWOCK_X64)
+/*
+Rotate each 64-bit lane of a vector right.
+Template: int count - The number of bits to rotate by, from 1 to 63.
+Parameter: __m256i words - The words to rotate.
+Returns: __m256i - The rotated words.
+*/
+template <int count>
+JABBERWOCK_TARGET_AVX2 static inline __m256i rotateRightAVX2(__m256i words) {
+	return _mm256_or_si256(_mm256_srli_epi64(words, count),
+		_mm256_slli_epi64(words, 64 - count));
+}
+
+/*
+Process a message block of each of 4 messages into their SHA-512 hash values,
+one message per 64-bit lane.
+Parameter: __m256i* hash - The 8 words of the hash values to update.
+Parameter: const uint8_t* const* blocks - The 128-byte message block of each
+lane.
+*/
+JABBERWOCK_TARGET_AVX2 static void compressBlocksAVX2(__m256i* hash,
+	const uint8_t* const* blocks) {
+	__m256i schedule[80];
+	for (size_t t = 0; t < 16; t++) {
+		uint64_t words[4];
+		for (size_t l = 0; l < 4; l++) {
+			uint64_t word = 0;
+			for (size_t j = 0; j < 8; j++) {
+				word = (word << 8) | blocks[l][t * 8 + j];
+			}
+			words[l] = word;
+		}
+		schedule[t] = _mm256_loadu_si256((const __m256i*)words);
+	}
+	for (size_t t = 16; t < 80; t++) {
+		__m256i w15 = schedule[t - 15];
+		__m256i w2 = schedule[t - 2];
+		__m256i s0 = _mm256_xor_si256(_mm256_xor_si256(
+			rotateRightAVX2<1>(w15), rotateRightAVX2<8>(w15)),
+			_mm256_srli_epi64(w15, 7));
+		__m256i s1 = _mm256_xor_si256(_mm256_xor_si256(
+			rotateRightAVX2<19>(w2), rotateRightAVX2<61>(w2)),
+			_mm256_srli_epi64(w2, 6));
+		schedule[t] = _mm256_add_epi64(_mm256_add_epi64(schedule[t - 16], s0),
+			_mm256_add_epi64(schedule[t - 7], s1));
+	}
+	__m256i a = hash[0];
+	__m256i b = hash[1];
+	__m256i c = hash[2];
+	__m256i d = hash[3];
+	__m256i e = hash[4];
+	__m256i f = hash[5];
+	__m256i g = hash[6];
+	__m256i h = hash[7];
+	for (size_t t = 0; t < 80; t++) {
+		__m256i sum1 = _mm256_xor_si256(_mm256_xor_si256(
+			rotateRightAVX2<14>(e), rotateRightAVX2<18>(e)),
+			rotateRightAVX2<41>(e));
+		__m256i choice = _mm256_xor_si256(_mm256_and_si256(e, f),
+			_mm256_andnot_si256(e, g));
+		__m256i t1 = _mm256_add_epi64(_mm256_add_epi64(h, sum1),
+			_mm256_add_epi64(_mm256_add_epi64(choice, schedule[t]),
+			_mm256_set1_epi64x((long long)SHA512_ROUND_CONSTANTS[t])));
+		__m256i sum0 = _mm256_xor_si256(_mm256_xor_si256(
+			rotateRightAVX2<28>(a), rotateRightAVX2<34>(a)),
+			rotateRightAVX2<39>(a));
+		__m256i majority = _mm256_xor_si256(_mm256_and_si256(a, b),
+			_mm256_and_si256(c, _mm256_xor_si256(a, b)));
+		__m256i t2 = _mm256_add_epi64(sum0, majority);
+		h = g;
+		g = f;
+		f = e;
+		e = _mm256_add_epi64(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = _mm256_add_epi64(t1, t2);
+	}
+	hash[0] = _mm256_add_epi64(hash[0], a);
+	hash[1] = _mm256_add_epi64(hash[1], b);
+	hash[2] = _mm256_add_epi64(hash[2], c);
+	hash[3] = _mm256_add_epi64(hash[3], d);
+	hash[4] = _mm256_add_epi64(hash[4], e);
+	hash[5] = _mm256_add_epi64(hash[5], f);
+	hash[6] = _mm256_add_epi64(hash[6], g);
+	hash[7] = _mm256_add_epi64(hash[7], h);
+}
+
+/*
+Compute the raw SHA-512 digests of 4 equal-length messages together, one per
+64-bit lane.
+Parameter: const uint8_t* inputs - The 4 messages, one after another.
+Parameter: size_t length - The number of bytes in each message.
+Parameter: SHA512Digest* digests - The 4 digests to fill.
+*/
+JABBERWOCK_TARGET_AVX2 static void hash4AVX2(const uint8_t* inputs,
+	size_t length, SHA512Digest* digests) {
+	__m256i hash[8];
+	for (size_t i = 0; i < 8; i++) {
+		hash[i] = _mm256_set1_epi64x((long long)SHA512_INITIAL_HASH[i]);
+	}
+	const uint8_t* blocks[4];
+	size_t fullLength = length - length % SHA512_BLOCK_LENGTH;
+	for (size_t i = 0; i < fullLength; i += SHA512_BLOCK_LENGTH) {
+		for (size_t l = 0; l < 4; l++) {
+			blocks[l] = inputs + l * length + i;
+		}
+		compressBlocksAVX2(hash, blocks);
+	}
+	// Equal lengths pad to the same number of tail blocks in every lane.
+	uint8_t tails[4][2 * SHA512_BLOCK_LENGTH];
+	size_t tailBlocks = 0;
+	for (size_t l = 0; l < 4; l++) {
+		tailBlocks = padTail(inputs + l * length, length, tails[l]);
+	}
+	for (size_t i = 0; i < tailBlocks; i++) {
+		for (size_t l = 0; l < 4; l++) {
+			blocks[l] = tails[l] + i * SHA512_BLOCK_LENGTH;
+		}
+		compressBlocksAVX2(hash, blocks);
+	}
+	uint64_t words[8][4];
+	for (size_t i = 0; i < 8; i++) {
+		_mm256_storeu_si256((__m256i*)words[i], hash[i]);
+	}
+	for (size_t l = 0; l < 4; l++) {
+		uint64_t laneHash[8];
+		for (size_t i = 0; i < 8; i++) {
+			laneHash[i] = words[i][l];
+		}
+		storeDigest(laneHash, digests[l]);
+	}
+}
+#endif
+
+SHA512Digest SHA512Raw(const uint8_t* input, size_t length) {
+	uint64_t hash[8];
+	std::memcpy(hash, SHA512_INITIAL_HASH, sizeof(hash));
+	size_t fullLength = length - length % SHA512_BLOCK_LENGTH;
+	for (size_t i = 0; i < fullLength; i += SHA512_BLOCK_LENGTH) {
+		compressBlock(hash, input + i);
+	}
+	uint8_t tail[2 * SHA512_BLOCK_LENGTH];
+	size_t tailBlocks = padTail(input, length, tail);
+	for (size_t i = 0; i < tailBlocks; i++) {
+		compressBlock(hash, tail + i * SHA512_BLOCK_LENGTH);
+	}
+	SHA512Digest digest;
+	storeDigest(hash, digest);
+	return digest;
+}
+
+SHA512Digest SHA512Raw(std::string_view input) {
+	return SHA512Raw((const uint8_t*)input.data(), input.length());
+}
+
+bool digestBit(const SHA512Digest& digest, size_t index) {
+	return (bool)((digest[index / 8] >> (7 - index % 8)) & 0x01);
+}
+
+uint8_t digestBits(const SHA512Digest& digest, size_t first, size_t count) {
+	uint8_t bits = 0x00;
+	for (size_t i = first; i < first + count; i++) {
+		bits <<= 1;
+		bits |= (uint8_t)digestBit(digest, i);
+	}
+	return bits;
+}
+
+void SHA512RawMany(const uint8_t* inputs, size_t length, size_t count,
+	SHA512Digest* digests) {
+	const static InstructionSet supported = detectInstructionSet();
+	SHA512RawMany(inputs, length, count, digests, supported);
+}
+
+void SHA512RawMany(const uint8_t* inputs, size_t length, size_t count,
+	SHA512Digest* digests, InstructionSet instructionSet) {
+	const static InstructionSet supported = detectInstructionSet();
+	if (instructionSet > supported) {
+		instructionSet = supported;
+	}
+	size_t i = 0;
+#if defined(JABBERWOCK_X64)
+	if (instructionSet == InstructionSet::AVX2) {
+		for (; i + 4 <= count; i += 4) {
+			hash4AVX2(inputs + i * length, length, digests + i);
+		}
+	}
+#endif
+	for (; i < count; i++) {
+		digests[i] = SHA512Raw(inputs + i * length, length);
+	}
+}
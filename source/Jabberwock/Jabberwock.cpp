@@ -6,17 +6,313 @@ Purpose:	Implement Jabberwock class functions found in Jabberwock.h.
 */
 
 #include "Jabberwock.h"
+#include "Snapshot.h"
+
+#include <algorithm>
 
 // Implement Jabberwock class functions.
 
 void Jabberwock::seed(const std::string& seed, unsigned int levelCount) {
-	m_root.seed(seed, levelCount - 1);
+	clear();
+	// The subtrees below the root are seeded concurrently on the pool, which
+	// is then narrowed to the subtrees evaluated in parallel.
+	m_pool.start(m_threadCount - 1);
+	m_root.seed(seed, levelCount - 1, m_threadCount > 1 ? &m_pool : nullptr);
+	const std::pmr::vector<Node*>& children = m_root.getChildren();
+	bool partitioned = m_threadCount > 1 && !children.empty();
+	for (const Node* child : children) {
+		if (child->getType() == NodeType::GLFSR) {
+			partitioned = false;
+		}
+	}
+	// The banks are created up front, since the nodes keep pointers to them.
+	m_subtrees.resize(partitioned ? children.size() : 1);
+	m_compiled = true;
+	for (size_t i = 0; i < m_subtrees.size(); i++) {
+		Node& root = partitioned ? *children[i] : m_root;
+		root.bankLeaves(m_subtrees[i].bank);
+		m_subtrees[i].bank.finalize();
+		m_compiled &= m_subtrees[i].program.compile(root, m_subtrees[i].bank);
+	}
+	if (m_compiled) {
+		m_root.release();
+		m_arena.reset();
+	}
+	m_pool.start(std::min((size_t)m_threadCount, m_subtrees.size()) - 1);
+	m_position = 0;
+}
+
+void Jabberwock::setThreadCount(unsigned int threadCount) {
+	m_threadCount = std::max(threadCount, 1u);
+}
+
+unsigned int Jabberwock::getThreadCount() const {
+	return m_threadCount;
 }
 
 uint8_t Jabberwock::generate() {
-	return m_root.generate();
+	m_position++;
+#if defined(JABBERWOCK_PROFILE)
+	m_profileBytes++;
+#endif
+	uint8_t byte = 0x00;
+	for (Subtree& subtree : m_subtrees) {
+		subtree.bank.step();
+		if (m_compiled) {
+			byte ^= subtree.program.run(subtree.bank.getOutputs());
+		}
+	}
+	return m_compiled ? byte : m_root.generate();
+}
+
+void Jabberwock::generate(uint8_t* output, size_t length) {
+	if (!m_compiled) {
+		for (size_t i = 0; i < length; i++) {
+			output[i] = generate();
+		}
+		return;
+	}
+	m_position += length;
+#if defined(JABBERWOCK_PROFILE)
+	m_profileBytes += length;
+#endif
+	if (m_subtrees.size() == 1) {
+		generateSubtree(m_subtrees[0], output, length);
+		return;
+	}
+	for (size_t offset = 0; offset < length;
+		offset += JABBERWOCK_PARALLEL_LENGTH) {
+		size_t batchLength = std::min(length - offset,
+			JABBERWOCK_PARALLEL_LENGTH);
+		m_pool.run(m_subtrees.size(), [this, batchLength](size_t i) {
+			m_subtrees[i].output.resize(JABBERWOCK_PARALLEL_LENGTH);
+			generateSubtree(m_subtrees[i], m_subtrees[i].output.data(),
+				batchLength);
+		});
+		JABBERWOCK_PROFILE_SCOPE(m_rootNanoseconds);
+		uint8_t* batch = output + offset;
+		std::copy(m_subtrees[0].output.begin(),
+			m_subtrees[0].output.begin() + batchLength, batch);
+		for (size_t i = 1; i < m_subtrees.size(); i++) {
+			const uint8_t* subtreeOutput = m_subtrees[i].output.data();
+			for (size_t t = 0; t < batchLength; t++) {
+				batch[t] ^= subtreeOutput[t];
+			}
+		}
+	}
+}
+
+void Jabberwock::generate(std::span<uint8_t> output) {
+	generate(output.data(), output.size());
+}
+
+void Jabberwock::discard(uint64_t count) {
+	m_pool.run(m_subtrees.size(), [this, count](size_t i) {
+		m_subtrees[i].bank.jump(count);
+	});
+	m_position += count;
+}
+
+void Jabberwock::seek(uint64_t offset) {
+	if (offset < m_position) {
+		for (Subtree& subtree : m_subtrees) {
+			subtree.bank.reset();
+		}
+		m_position = 0;
+	}
+	discard(offset - m_position);
+}
+
+uint64_t Jabberwock::getPosition() const {
+	return m_position;
+}
+
+bool Jabberwock::save(std::ostream& output) const {
+	if (!m_compiled) {
+		return false;
+	}
+	writeSnapshotValue(output, JABBERWOCK_SNAPSHOT_MAGIC);
+	writeSnapshotValue(output, JABBERWOCK_SNAPSHOT_VERSION);
+	writeSnapshotValue(output, m_position);
+	writeSnapshotValue(output, (uint64_t)m_subtrees.size());
+	for (const Subtree& subtree : m_subtrees) {
+		subtree.bank.save(output);
+		subtree.program.save(output);
+	}
+	return (bool)output;
+}
+
+bool Jabberwock::load(std::istream& input) {
+	clear();
+	uint32_t magic = 0;
+	uint32_t version = 0;
+	uint64_t position = 0;
+	uint64_t subtreeCount = 0;
+	if (!readSnapshotValue(input, magic)
+		|| magic != JABBERWOCK_SNAPSHOT_MAGIC
+		|| !readSnapshotValue(input, version)
+		|| version != JABBERWOCK_SNAPSHOT_VERSION
+		|| !readSnapshotValue(input, position)
+		|| !readSnapshotValue(input, subtreeCount) || subtreeCount == 0
+		|| subtreeCount > JABBERWOCK_SNAPSHOT_MAXIMUM_COUNT) {
+		return false;
+	}
+	// The subtrees are added as they are read, so that a truncated snapshot
+	// fails before its claimed subtree count is allocated.
+	for (uint64_t i = 0; i < subtreeCount; i++) {
+		Subtree& subtree = m_subtrees.emplace_back();
+		if (!subtree.bank.load(input)
+			|| !subtree.program.load(input, subtree.bank)) {
+			clear();
+			return false;
+		}
+	}
+	m_compiled = true;
+	m_position = position;
+	m_pool.start(std::min((size_t)m_threadCount, m_subtrees.size()) - 1);
+	return true;
+}
+
+bool Jabberwock::clone(Jabberwock& copy) const {
+	if (&copy == this) {
+		return m_compiled;
+	}
+	copy.clear();
+	if (!m_compiled) {
+		return false;
+	}
+	copy.m_subtrees.resize(m_subtrees.size());
+	for (size_t i = 0; i < m_subtrees.size(); i++) {
+		copy.m_subtrees[i].bank = m_subtrees[i].bank;
+		copy.m_subtrees[i].program = m_subtrees[i].program;
+	}
+	copy.m_compiled = true;
+	copy.m_threadCount = m_threadCount;
+	copy.m_position = m_position;
+	copy.m_pool.start(std::min((size_t)m_threadCount, m_subtrees.size()) - 1);
+	return true;
+}
+
+bool Jabberwock::substream(uint64_t index, Jabberwock& stream) const {
+	if (index >= JABBERWOCK_SUBSTREAM_COUNT) {
+		return false;
+	}
+	if (!clone(stream)) {
+		return false;
+	}
+	stream.seek(index * JABBERWOCK_SUBSTREAM_LENGTH);
+	return true;
+}
+
+bool Jabberwock::emitSource(std::ostream& output,
+	const std::string& className) const {
+	if (!m_compiled) {
+		return false;
+	}
+	CodeGenerator generator;
+	for (const Subtree& subtree : m_subtrees) {
+		generator.addSubtree(subtree.bank, subtree.program);
+	}
+	return generator.write(output, className, m_position);
+}
+
+bool Jabberwock::getStatistics(Statistics& statistics) const {
+	if (!m_compiled) {
+		return false;
+	}
+	statistics = Statistics();
+	statistics.configCounts.assign(GLFSR_CONFIGS.size(), 0);
+	statistics.subtreeCount = m_subtrees.size();
+	statistics.heapBytes = m_subtrees.capacity() * sizeof(Subtree)
+		+ m_arena.getCapacity();
+	for (const Subtree& subtree : m_subtrees) {
+		for (size_t type = 0; type < 3; type++) {
+			statistics.nodeCounts[type]
+				+= subtree.bank.getGateCount((NodeType)type);
+		}
+		for (const LeafBank::Group& group : subtree.bank.getGroups()) {
+			size_t leafCount = subtree.bank.getLeafCount(group);
+			statistics.nodeCounts[(size_t)NodeType::GLFSR] += leafCount;
+			statistics.configCounts[group.config] += leafCount;
+			statistics.stateBytes += leafCount * group.wordCount
+				* sizeof(uint64_t);
+		}
+		// A gate loaded from the bank sits over a level of GLFSRs, and every
+		// other gate is a level over its deepest operand.
+		const std::vector<TreeProgram::Instruction>& instructions
+			= subtree.program.getInstructions();
+		std::vector<size_t> depths(instructions.size());
+		for (size_t i = 0; i < instructions.size(); i++) {
+			const TreeProgram::Instruction& instruction = instructions[i];
+			if (instruction.op == TreeOperation::LOAD) {
+				depths[i] = 2;
+				continue;
+			}
+			statistics.nodeCounts[(size_t)instruction.op - 1]++;
+			depths[i] = 1 + *std::max_element(depths.begin()
+				+ instruction.first, depths.begin() + instruction.first
+				+ instruction.count);
+		}
+		statistics.depth = std::max(statistics.depth, depths.back());
+		statistics.heapBytes += subtree.bank.getHeapBytes()
+			+ subtree.program.getHeapBytes() + subtree.blockOutputs.capacity()
+			+ subtree.output.capacity();
+	}
+	// Parallel subtrees are the children of the root, which is evaluated by
+	// XORing their outputs rather than by a program.
+	if (m_subtrees.size() > 1) {
+		statistics.nodeCounts[(size_t)NodeType::XOR]++;
+		statistics.depth++;
+	}
+	return true;
+}
+
+Jabberwock::Profile Jabberwock::getProfile() const {
+	Profile profile = {};
+	for (const Subtree& subtree : m_subtrees) {
+		for (size_t type = 0; type < 4; type++) {
+			profile.nanoseconds[type]
+				+= subtree.bank.getNanoseconds((NodeType)type)
+				+ subtree.program.getNanoseconds((NodeType)type);
+		}
+	}
+	profile.nanoseconds[(size_t)NodeType::XOR] += m_rootNanoseconds;
+	profile.byteCount = m_profileBytes;
+	return profile;
+}
+
+void Jabberwock::resetProfile() {
+	for (Subtree& subtree : m_subtrees) {
+		subtree.bank.resetProfile();
+		subtree.program.resetProfile();
+	}
+	m_rootNanoseconds = 0;
+	m_profileBytes = 0;
 }
 
 void Jabberwock::clear() {
-	m_root.clear();
-}
\ No newline at end of file
+	m_root.release();
+	m_arena.reset();
+	for (Subtree& subtree : m_subtrees) {
+		subtree.bank.clear();
+		subtree.program.clear();
+	}
+	m_subtrees.clear();
+	m_compiled = false;
+	m_position = 0;
+	m_rootNanoseconds = 0;
+	m_profileBytes = 0;
+}
+
+void Jabberwock::generateSubtree(Subtree& subtree, uint8_t* output,
+	size_t length) {
+	subtree.blockOutputs.resize(subtree.bank.getOutputCount()
+		* JABBERWOCK_BLOCK_LENGTH);
+	for (size_t offset = 0; offset < length;
+		offset += JABBERWOCK_BLOCK_LENGTH) {
+		size_t blockLength = std::min(length - offset, JABBERWOCK_BLOCK_LENGTH);
+		subtree.bank.stepBlock(subtree.blockOutputs.data(), blockLength);
+		subtree.program.runBlock(subtree.blockOutputs.data(), output + offset,
+			blockLength);
+	}
+}
@@ -0,0 +1,621 @@
+/*
+File:		LeafBank.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@10:48
+Purpose:	Implement the LeafBank class functions found in LeafBank.h.
+*/
+
+#include "LeafBank.h"
+#include "Snapshot.h"
+
+#include <array>
+#include <utility>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#include <immintrin.h>
+#define JABBERWOCK_X64
+#if defined(_MSC_VER)
+#define JABBERWOCK_TARGET_AVX2
+#else
+#define JABBERWOCK_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+// Implement LeafBank module functions.
+
+/*
+Round a count up to a whole number of 4-wide vectors.
+Parameter: size_t count - The count to round up.
+Returns: size_t - The smallest multiple of 4 not less than the count.
+*/
+static size_t padLanes(size_t count) {
+	return (count + 3) & ~(size_t)3;
+}
+
+/*
+Advance every lane of a GLFSR group by a byte one lane at a time.
+Template: typename Fixed - The fixed GLFSR type of the group's configuration,
+whose constants the kernel is specialized on.
+Parameter: LeafBank::Group& group - The group to advance.
+Parameter: uint8_t* slots - The gate slots to write the output bytes into.
+*/
+template <typename Fixed>
+static void stepGroupScalar(LeafBank::Group& group, uint8_t* slots) {
+	static_assert(Fixed::BYTE_STEP, "Lane groups step a byte at a time.");
+	constexpr size_t topWord = Fixed::WORD_COUNT - 1;
+	constexpr size_t outputWord = (Fixed::LENGTH - 8) / 64;
+	constexpr size_t outputShift = (Fixed::LENGTH - 8) % 64;
+	constexpr const uint64_t* feedbackTable = Fixed::FEEDBACK_TABLE.data();
+	size_t laneCount = group.laneCount;
+	uint64_t* state = group.state.data();
+	for (size_t lane = 0; lane < laneCount; lane++) {
+		uint64_t outputBits = state[outputWord * laneCount + lane]
+			>> outputShift;
+		if constexpr (outputShift > 56) {
+			outputBits |= state[(outputWord + 1) * laneCount + lane]
+				<< (64 - outputShift);
+		}
+		group.outputs[lane] = (uint8_t)outputBits;
+	}
+	for (size_t i = topWord; i > 0; i--) {
+		uint64_t* word = state + i * laneCount;
+		const uint64_t* lowerWord = word - laneCount;
+		for (size_t lane = 0; lane < laneCount; lane++) {
+			word[lane] = (word[lane] << 8) | (lowerWord[lane] >> 56);
+		}
+	}
+	for (size_t lane = 0; lane < laneCount; lane++) {
+		state[lane] <<= 8;
+		state[topWord * laneCount + lane] &= Fixed::TOP_MASK;
+		state[lane] ^= feedbackTable[group.outputs[lane]];
+		slots[group.destinations[lane]] = group.outputs[lane];
+	}
+}
+
+/*
+Combine the slots of a range of gates into their output bytes one gate at a
+time.
+Parameter: NodeType type - The type of the gates.
+Parameter: const uint64_t* slots - The slots of the gates.
+Parameter: uint64_t* outputs - The outputs of the gates.
+Parameter: size_t count - The number of gates.
+*/
+static void combineScalar(NodeType type, const uint64_t* slots,
+	uint64_t* outputs, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		uint64_t slot = slots[i];
+		if (type == NodeType::XOR) {
+			slot ^= slot >> 32;
+			slot ^= slot >> 16;
+			slot ^= slot >> 8;
+		}
+		else if (type == NodeType::AND) {
+			slot &= slot >> 32;
+			slot &= slot >> 16;
+			slot &= slot >> 8;
+		}
+		else {
+			slot |= slot >> 32;
+			slot |= slot >> 16;
+			slot |= slot >> 8;
+		}
+		outputs[i] = slot;
+	}
+}
+
+#if defined(JABBERWOCK_X64)
+/*
+Advance every lane of a GLFSR group by a byte, 2 lanes at a time with SSE2.
+Template: typename Fixed - The fixed GLFSR type of the group's configuration.
+Parameter: LeafBank::Group& group - The group to advance.
+Parameter: uint8_t* slots - The gate slots to write the output bytes into.
+*/
+template <typename Fixed>
+static void stepGroupSSE2(LeafBank::Group& group, uint8_t* slots) {
+	static_assert(Fixed::BYTE_STEP, "Lane groups step a byte at a time.");
+	constexpr size_t topWord = Fixed::WORD_COUNT - 1;
+	constexpr size_t outputWord = (Fixed::LENGTH - 8) / 64;
+	constexpr size_t outputShift = (Fixed::LENGTH - 8) % 64;
+	constexpr const uint64_t* feedbackTable = Fixed::FEEDBACK_TABLE.data();
+	size_t laneCount = group.laneCount;
+	__m128i topMask = _mm_set1_epi64x((long long)Fixed::TOP_MASK);
+	__m128i byteMask = _mm_set1_epi64x(0xFF);
+	uint64_t* state = group.state.data();
+	for (size_t lane = 0; lane < laneCount; lane += 2) {
+		__m128i outputBits = _mm_srli_epi64(_mm_loadu_si128((const __m128i*)(
+			state + outputWord * laneCount + lane)), (int)outputShift);
+		if constexpr (outputShift > 56) {
+			outputBits = _mm_or_si128(outputBits, _mm_slli_epi64(
+				_mm_loadu_si128((const __m128i*)(state + (outputWord + 1)
+					* laneCount + lane)), (int)(64 - outputShift)));
+		}
+		alignas(16) uint64_t bytes[2];
+		_mm_store_si128((__m128i*)bytes, _mm_and_si128(outputBits, byteMask));
+		__m128i word = _mm_loadu_si128((const __m128i*)(state
+			+ topWord * laneCount + lane));
+		for (size_t i = topWord; i > 0; i--) {
+			__m128i lowerWord = _mm_loadu_si128((const __m128i*)(state
+				+ (i - 1) * laneCount + lane));
+			word = _mm_or_si128(_mm_slli_epi64(word, 8),
+				_mm_srli_epi64(lowerWord, 56));
+			if (i == topWord) {
+				word = _mm_and_si128(word, topMask);
+			}
+			_mm_storeu_si128((__m128i*)(state + i * laneCount + lane), word);
+			word = lowerWord;
+		}
+		word = _mm_slli_epi64(word, 8);
+		if constexpr (topWord == 0) {
+			word = _mm_and_si128(word, topMask);
+		}
+		__m128i feedback = _mm_set_epi64x((long long)feedbackTable[bytes[1]],
+			(long long)feedbackTable[bytes[0]]);
+		_mm_storeu_si128((__m128i*)(state + lane), _mm_xor_si128(word,
+			feedback));
+		for (size_t i = 0; i < 2; i++) {
+			group.outputs[lane + i] = (uint8_t)bytes[i];
+			slots[group.destinations[lane + i]] = (uint8_t)bytes[i];
+		}
+	}
+}
+
+/*
+Combine the slots of a range of gates into their output bytes, 2 gates at a
+time with SSE2.
+Parameter: NodeType type - The type of the gates.
+Parameter: const uint64_t* slots - The slots of the gates.
+Parameter: uint64_t* outputs - The outputs of the gates.
+Parameter: size_t count - The number of gates, a multiple of 2.
+*/
+static void combineSSE2(NodeType type, const uint64_t* slots,
+	uint64_t* outputs, size_t count) {
+	for (size_t i = 0; i < count; i += 2) {
+		__m128i slot = _mm_loadu_si128((const __m128i*)(slots + i));
+		if (type == NodeType::XOR) {
+			slot = _mm_xor_si128(slot, _mm_srli_epi64(slot, 32));
+			slot = _mm_xor_si128(slot, _mm_srli_epi64(slot, 16));
+			slot = _mm_xor_si128(slot, _mm_srli_epi64(slot, 8));
+		}
+		else if (type == NodeType::AND) {
+			slot = _mm_and_si128(slot, _mm_srli_epi64(slot, 32));
+			slot = _mm_and_si128(slot, _mm_srli_epi64(slot, 16));
+			slot = _mm_and_si128(slot, _mm_srli_epi64(slot, 8));
+		}
+		else {
+			slot = _mm_or_si128(slot, _mm_srli_epi64(slot, 32));
+			slot = _mm_or_si128(slot, _mm_srli_epi64(slot, 16));
+			slot = _mm_or_si128(slot, _mm_srli_epi64(slot, 8));
+		}
+		_mm_storeu_si128((__m128i*)(outputs + i), slot);
+	}
+}
+
+/*
+Advance every lane of a GLFSR group by a byte, 4 lanes at a time with AVX2.
+Template: typename Fixed - The fixed GLFSR type of the group's configuration.
+Parameter: LeafBank::Group& group - The group to advance.
+Parameter: uint8_t* slots - The gate slots to write the output bytes into.
+*/
+template <typename Fixed>
+JABBERWOCK_TARGET_AVX2 static void stepGroupAVX2(LeafBank::Group& group,
+	uint8_t* slots) {
+	static_assert(Fixed::BYTE_STEP, "Lane groups step a byte at a time.");
+	constexpr size_t topWord = Fixed::WORD_COUNT - 1;
+	constexpr size_t outputWord = (Fixed::LENGTH - 8) / 64;
+	constexpr size_t outputShift = (Fixed::LENGTH - 8) % 64;
+	constexpr const uint64_t* feedbackTable = Fixed::FEEDBACK_TABLE.data();
+	size_t laneCount = group.laneCount;
+	__m256i topMask = _mm256_set1_epi64x((long long)Fixed::TOP_MASK);
+	__m256i byteMask = _mm256_set1_epi64x(0xFF);
+	uint64_t* state = group.state.data();
+	for (size_t lane = 0; lane < laneCount; lane += 4) {
+		__m256i outputBits = _mm256_srli_epi64(_mm256_loadu_si256(
+			(const __m256i*)(state + outputWord * laneCount + lane)),
+			(int)outputShift);
+		if constexpr (outputShift > 56) {
+			outputBits = _mm256_or_si256(outputBits, _mm256_slli_epi64(
+				_mm256_loadu_si256((const __m256i*)(state + (outputWord + 1)
+					* laneCount + lane)), (int)(64 - outputShift)));
+		}
+		__m256i bytes = _mm256_and_si256(outputBits, byteMask);
+		__m256i word = _mm256_loadu_si256((const __m256i*)(state
+			+ topWord * laneCount + lane));
+		for (size_t i = topWord; i > 0; i--) {
+			__m256i lowerWord = _mm256_loadu_si256((const __m256i*)(state
+				+ (i - 1) * laneCount + lane));
+			word = _mm256_or_si256(_mm256_slli_epi64(word, 8),
+				_mm256_srli_epi64(lowerWord, 56));
+			if (i == topWord) {
+				word = _mm256_and_si256(word, topMask);
+			}
+			_mm256_storeu_si256((__m256i*)(state + i * laneCount + lane),
+				word);
+			word = lowerWord;
+		}
+		word = _mm256_slli_epi64(word, 8);
+		if constexpr (topWord == 0) {
+			word = _mm256_and_si256(word, topMask);
+		}
+		__m256i feedback = _mm256_i64gather_epi64(
+			(const long long*)feedbackTable, bytes, 8);
+		_mm256_storeu_si256((__m256i*)(state + lane), _mm256_xor_si256(word,
+			feedback));
+		alignas(32) uint64_t laneBytes[4];
+		_mm256_store_si256((__m256i*)laneBytes, bytes);
+		for (size_t i = 0; i < 4; i++) {
+			group.outputs[lane + i] = (uint8_t)laneBytes[i];
+			slots[group.destinations[lane + i]] = (uint8_t)laneBytes[i];
+		}
+	}
+}
+
+/*
+Combine the slots of a range of gates into their output bytes, 4 gates at a
+time with AVX2.
+Parameter: NodeType type - The type of the gates.
+Parameter: const uint64_t* slots - The slots of the gates.
+Parameter: uint64_t* outputs - The outputs of the gates.
+Parameter: size_t count - The number of gates, a multiple of 4.
+*/
+JABBERWOCK_TARGET_AVX2 static void combineAVX2(NodeType type,
+	const uint64_t* slots, uint64_t* outputs, size_t count) {
+	for (size_t i = 0; i < count; i += 4) {
+		__m256i slot = _mm256_loadu_si256((const __m256i*)(slots + i));
+		if (type == NodeType::XOR) {
+			slot = _mm256_xor_si256(slot, _mm256_srli_epi64(slot, 32));
+			slot = _mm256_xor_si256(slot, _mm256_srli_epi64(slot, 16));
+			slot = _mm256_xor_si256(slot, _mm256_srli_epi64(slot, 8));
+		}
+		else if (type == NodeType::AND) {
+			slot = _mm256_and_si256(slot, _mm256_srli_epi64(slot, 32));
+			slot = _mm256_and_si256(slot, _mm256_srli_epi64(slot, 16));
+			slot = _mm256_and_si256(slot, _mm256_srli_epi64(slot, 8));
+		}
+		else {
+			slot = _mm256_or_si256(slot, _mm256_srli_epi64(slot, 32));
+			slot = _mm256_or_si256(slot, _mm256_srli_epi64(slot, 16));
+			slot = _mm256_or_si256(slot, _mm256_srli_epi64(slot, 8));
+		}
+		_mm256_storeu_si256((__m256i*)(outputs + i), slot);
+	}
+}
+#endif
+
+// A kernel which advances every lane of a GLFSR group by a byte.
+typedef void (*StepGroupKernel)(LeafBank::Group&, uint8_t*);
+
+/*
+Build the table of step kernels, with a row per GLFSR configuration holding its
+kernel for each instruction set. Without x64 every instruction set uses the
+scalar kernel.
+Template: size_t... Configs - The indices of the configurations.
+Returns: std::array<std::array<StepGroupKernel, 3>, sizeof...(Configs)> - The
+table, indexed by configuration then instruction set.
+*/
+template <size_t... Configs>
+constexpr std::array<std::array<StepGroupKernel, 3>, sizeof...(Configs)>
+	buildStepKernels(std::index_sequence<Configs...>) {
+	return { std::array<StepGroupKernel, 3>{
+		&stepGroupScalar<FixedGLFSRType<Configs>>,
+#if defined(JABBERWOCK_X64)
+		&stepGroupSSE2<FixedGLFSRType<Configs>>,
+		&stepGroupAVX2<FixedGLFSRType<Configs>>,
+#else
+		&stepGroupScalar<FixedGLFSRType<Configs>>,
+		&stepGroupScalar<FixedGLFSRType<Configs>>,
+#endif
+	}... };
+}
+
+// The step kernel of each GLFSR configuration and instruction set, each
+// specialized on the configuration's fixed GLFSR type.
+constexpr static std::array<std::array<StepGroupKernel, 3>,
+	std::variant_size_v<FixedGLFSRVariant>> STEP_KERNELS = buildStepKernels(
+	std::make_index_sequence<std::variant_size_v<FixedGLFSRVariant>>());
+
+// Implement LeafBank class functions.
+
+bool LeafBank::addGate(NodeType type, const std::vector<const GLFSR*>& leaves,
+	size_t& index) {
+	if (type == NodeType::GLFSR || leaves.empty() || leaves.size() > 8) {
+		return false;
+	}
+	for (const GLFSR* leaf : leaves) {
+		if (GLFSRFeedbackTable(leaf->getConfig()) == nullptr) {
+			return false;
+		}
+	}
+	index = m_gateCounts[(size_t)type]++;
+	for (size_t i = 0; i < leaves.size(); i++) {
+		const std::pmr::vector<uint64_t>& state = leaves[i]->getState();
+		m_pending.push_back({ leaves[i]->getConfig(),
+			std::vector<uint64_t>(state.begin(), state.end()), type, index,
+			i, });
+	}
+	return true;
+}
+
+void LeafBank::finalize() {
+	size_t sinkSlot = layoutSlots();
+	m_groups.clear();
+	for (size_t config = 0; config < GLFSR_CONFIGS.size(); config++) {
+		std::vector<const PendingLeaf*> leaves;
+		for (const PendingLeaf& leaf : m_pending) {
+			if (leaf.config == config) {
+				leaves.push_back(&leaf);
+			}
+		}
+		if (leaves.empty()) {
+			continue;
+		}
+		Group group;
+		initializeGroup(group, config, padLanes(leaves.size()));
+		group.destinations.assign(group.laneCount,
+			(uint32_t)(sinkSlot * 8));
+		for (size_t lane = 0; lane < leaves.size(); lane++) {
+			for (size_t i = 0; i < group.wordCount; i++) {
+				group.state[i * group.laneCount + lane] = leaves[lane]->state[i];
+			}
+			size_t slot = m_gateStarts[(size_t)leaves[lane]->type]
+				+ leaves[lane]->gate;
+			group.destinations[lane] = (uint32_t)(slot * 8
+				+ leaves[lane]->position);
+		}
+		group.initialState = group.state;
+		m_groups.push_back(std::move(group));
+	}
+	m_pending.clear();
+	m_instructionSet = detectInstructionSet();
+}
+
+void LeafBank::step() {
+	uint8_t* slotBytes = (uint8_t*)m_slots.data();
+	{
+		JABBERWOCK_PROFILE_SCOPE(m_nanoseconds[(size_t)NodeType::GLFSR]);
+		for (Group& group : m_groups) {
+			STEP_KERNELS[group.config][(size_t)m_instructionSet](group,
+				slotBytes);
+		}
+	}
+	for (size_t i = 0; i < 3; i++) {
+		JABBERWOCK_PROFILE_SCOPE(m_nanoseconds[i]);
+		size_t start = m_gateStarts[i];
+		size_t count = padLanes(m_gateCounts[i]);
+#if defined(JABBERWOCK_X64)
+		if (m_instructionSet == InstructionSet::AVX2) {
+			combineAVX2((NodeType)i, m_slots.data() + start,
+				m_outputs.data() + start, count);
+			continue;
+		}
+		if (m_instructionSet == InstructionSet::SSE2) {
+			combineSSE2((NodeType)i, m_slots.data() + start,
+				m_outputs.data() + start, count);
+			continue;
+		}
+#endif
+		combineScalar((NodeType)i, m_slots.data() + start,
+			m_outputs.data() + start, count);
+	}
+}
+
+void LeafBank::stepBlock(uint8_t* outputs, size_t length) {
+	for (size_t t = 0; t < length; t++) {
+		step();
+		for (size_t i = 0; i < m_outputs.size(); i++) {
+			outputs[i * length + t] = (uint8_t)m_outputs[i];
+		}
+	}
+}
+
+void LeafBank::jump(uint64_t count) {
+	// Jump in pieces small enough for their step counts to fit in 64 bits.
+	const uint64_t MAXIMUM_JUMP = 1ULL << 60;
+	while (count > 0) {
+		uint64_t jump = count < MAXIMUM_JUMP ? count : MAXIMUM_JUMP;
+		for (Group& group : m_groups) {
+			std::vector<uint64_t> jumpPolynomial = GLFSRJumpPolynomial(
+				group.config, jump * 8);
+			std::vector<uint64_t> state(group.wordCount);
+			for (size_t lane = 0; lane < group.laneCount; lane++) {
+				for (size_t i = 0; i < group.wordCount; i++) {
+					state[i] = group.state[i * group.laneCount + lane];
+				}
+				GLFSRApplyJump(group.config, state.data(), jumpPolynomial);
+				for (size_t i = 0; i < group.wordCount; i++) {
+					group.state[i * group.laneCount + lane] = state[i];
+				}
+			}
+		}
+		count -= jump;
+	}
+}
+
+void LeafBank::reset() {
+	for (Group& group : m_groups) {
+		group.state = group.initialState;
+	}
+}
+
+uint8_t LeafBank::getOutput(NodeType type, size_t index) const {
+	return (uint8_t)m_outputs[m_gateStarts[(size_t)type] + index];
+}
+
+size_t LeafBank::getOutputIndex(NodeType type, size_t index) const {
+	return m_gateStarts[(size_t)type] + index;
+}
+
+const uint64_t* LeafBank::getOutputs() const {
+	return m_outputs.data();
+}
+
+size_t LeafBank::getOutputCount() const {
+	return m_outputs.size();
+}
+
+InstructionSet LeafBank::getInstructionSet() const {
+	return m_instructionSet;
+}
+
+void LeafBank::setInstructionSet(InstructionSet instructionSet) {
+	InstructionSet supported = detectInstructionSet();
+	m_instructionSet = instructionSet < supported ? instructionSet : supported;
+}
+
+void LeafBank::save(std::ostream& output) const {
+	for (size_t i = 0; i < 3; i++) {
+		writeSnapshotValue(output, (uint64_t)m_gateCounts[i]);
+	}
+	writeSnapshotValue(output, (uint64_t)m_groups.size());
+	for (const Group& group : m_groups) {
+		writeSnapshotValue(output, (uint64_t)group.config);
+		writeSnapshotValue(output, (uint64_t)group.laneCount);
+		writeSnapshotValues(output, group.destinations.data(),
+			group.destinations.size());
+		writeSnapshotValues(output, group.state.data(), group.state.size());
+		writeSnapshotValues(output, group.initialState.data(),
+			group.initialState.size());
+	}
+}
+
+bool LeafBank::load(std::istream& input) {
+	clear();
+	for (size_t i = 0; i < 3; i++) {
+		uint64_t gateCount = 0;
+		if (!readSnapshotValue(input, gateCount)
+			|| gateCount > JABBERWOCK_SNAPSHOT_MAXIMUM_COUNT) {
+			clear();
+			return false;
+		}
+		m_gateCounts[i] = (size_t)gateCount;
+	}
+	layoutSlots();
+	uint64_t groupCount = 0;
+	if (!readSnapshotValue(input, groupCount)
+		|| groupCount > GLFSR_CONFIGS.size()) {
+		clear();
+		return false;
+	}
+	for (uint64_t g = 0; g < groupCount; g++) {
+		uint64_t config = 0;
+		uint64_t laneCount = 0;
+		if (!readSnapshotValue(input, config)
+			|| !readSnapshotValue(input, laneCount)
+			|| config >= GLFSR_CONFIGS.size() || laneCount == 0
+			|| laneCount != padLanes((size_t)laneCount)
+			|| laneCount > JABBERWOCK_SNAPSHOT_MAXIMUM_COUNT) {
+			clear();
+			return false;
+		}
+		Group group;
+		initializeGroup(group, (size_t)config, (size_t)laneCount);
+		group.destinations.resize(group.laneCount);
+		group.initialState.resize(group.state.size());
+		if (!readSnapshotValues(input, group.destinations.data(),
+			group.destinations.size())
+			|| !readSnapshotValues(input, group.state.data(),
+			group.state.size())
+			|| !readSnapshotValues(input, group.initialState.data(),
+			group.initialState.size())) {
+			clear();
+			return false;
+		}
+		for (uint32_t destination : group.destinations) {
+			if (destination >= m_slots.size() * 8) {
+				clear();
+				return false;
+			}
+		}
+		m_groups.push_back(std::move(group));
+	}
+	m_instructionSet = detectInstructionSet();
+	return true;
+}
+
+void LeafBank::clear() {
+	for (Group& group : m_groups) {
+		for (size_t i = 0; i < group.state.size(); i++) {
+			group.state[i] = 0;
+			group.initialState[i] = 0;
+		}
+	}
+	m_groups.clear();
+	m_pending.clear();
+	m_slots.clear();
+	m_outputs.clear();
+	for (size_t i = 0; i < 3; i++) {
+		m_gateCounts[i] = 0;
+		m_gateStarts[i] = 0;
+	}
+	m_instructionSet = InstructionSet::SCALAR;
+	resetProfile();
+}
+
+const std::vector<LeafBank::Group>& LeafBank::getGroups() const {
+	return m_groups;
+}
+
+size_t LeafBank::getGateCount(NodeType type) const {
+	return m_gateCounts[(size_t)type];
+}
+
+size_t LeafBank::getLeafCount(const Group& group) const {
+	// Padding lanes write to the slot after every gate's slot.
+	size_t sinkSlot = m_gateStarts[(size_t)NodeType::OR]
+		+ padLanes(m_gateCounts[(size_t)NodeType::OR]);
+	size_t count = 0;
+	for (uint32_t destination : group.destinations) {
+		count += destination / 8 != sinkSlot ? 1 : 0;
+	}
+	return count;
+}
+
+size_t LeafBank::getHeapBytes() const {
+	size_t bytes = m_groups.capacity() * sizeof(Group);
+	for (const Group& group : m_groups) {
+		bytes += (group.state.capacity() + group.initialState.capacity())
+			* sizeof(uint64_t) + group.destinations.capacity()
+			* sizeof(uint32_t) + group.outputs.capacity();
+	}
+	for (const PendingLeaf& leaf : m_pending) {
+		bytes += leaf.state.capacity() * sizeof(uint64_t);
+	}
+	return bytes + m_pending.capacity() * sizeof(PendingLeaf)
+		+ (m_slots.capacity() + m_outputs.capacity()) * sizeof(uint64_t);
+}
+
+uint64_t LeafBank::getNanoseconds(NodeType type) const {
+	return m_nanoseconds[(size_t)type];
+}
+
+void LeafBank::resetProfile() {
+	for (size_t i = 0; i < 4; i++) {
+		m_nanoseconds[i] = 0;
+	}
+}
+
+size_t LeafBank::layoutSlots() {
+	size_t slotCount = 0;
+	for (size_t i = 0; i < 3; i++) {
+		m_gateStarts[i] = slotCount;
+		slotCount += padLanes(m_gateCounts[i]);
+	}
+	m_slots.assign(padLanes(slotCount + 1), 0);
+	m_outputs.assign(m_slots.size(), 0);
+	size_t andStart = m_gateStarts[(size_t)NodeType::AND];
+	for (size_t i = 0; i < m_gateCounts[(size_t)NodeType::AND]; i++) {
+		m_slots[andStart + i] = ~0ULL;
+	}
+	return slotCount;
+}
+
+void LeafBank::initializeGroup(Group& group, size_t config, size_t laneCount) {
+	group.config = config;
+	group.length = GLFSR_CONFIGS[config][0];
+	group.wordCount = (group.length + 63) / 64;
+	size_t topBits = group.length - (group.wordCount - 1) * 64;
+	group.topMask = topBits == 64 ? ~0ULL : (1ULL << topBits) - 1;
+	group.feedback = GLFSRFeedbackTable(config);
+	group.laneCount = laneCount;
+	group.state.assign(group.wordCount * group.laneCount, 0);
+	group.outputs.assign(group.laneCount, 0);
+}
@@ -6,15 +6,48 @@ Purpose:	Implement the Node class functions found in Nodes.h.
 */
 
 #include "Nodes.h"
+#include "LeafBank.h"
 #include "Utilities.h"
 
 // Implement Node class functions.
 
-void Node::seed(const std::string& seed, unsigned int levelCount) {
-	std::string permutedSeed = permuteString(seed);
-	for (Node* child : m_children) {
-		child->seed(permutedSeed, levelCount - 1);
-		permutedSeed = permuteString(permutedSeed);
+Node::Node(NodeArena* arena) : m_children(arena), m_arena(arena) {}
+
+void Node::seed(std::string_view seed, unsigned int levelCount,
+	ThreadPool* pool) {
+	if (pool != nullptr && pool->getWorkerCount() > 0
+		&& m_children.size() > 1) {
+		// Each permutation gets its own buffer, so that every child's seed
+		// outlives the derivation of the next one.
+		std::string_view* childSeeds = (std::string_view*)m_arena->allocate(
+			sizeof(std::string_view) * m_children.size(),
+			alignof(std::string_view));
+		const char* previous = seed.data();
+		size_t length = seed.length();
+		for (size_t i = 0; i < m_children.size(); i++) {
+			char* permutedSeed = (char*)m_arena->allocate(
+				permutedLength(length), 1);
+			length = permuteString(previous, length, permutedSeed);
+			childSeeds[i] = std::string_view(permutedSeed, length);
+			previous = permutedSeed;
+		}
+		pool->run(m_children.size(), [&](size_t i) {
+			m_children[i]->seed(childSeeds[i], levelCount - 1);
+		});
+		return;
+	}
+	// Each permutation grows the seed by 8 characters, and is made in place
+	// once the previous child has been seeded from it.
+	size_t length = permutedLength(seed.length());
+	char* permutedSeed = (char*)m_arena->allocate(length
+		+ 8 * m_children.size(), 1);
+	length = permuteString(seed.data(), seed.length(), permutedSeed);
+	for (size_t i = 0; i < m_children.size(); i++) {
+		m_children[i]->seed(std::string_view(permutedSeed, length),
+			levelCount - 1);
+		if (i + 1 < m_children.size()) {
+			length = permuteString(permutedSeed, length, permutedSeed);
+		}
 	}
 }
 
@@ -22,5 +55,51 @@ void Node::clear() {
 	for (Node* child : m_children) {
 		child->clear();
 	}
-	m_children.clear();
+	release();
+}
+
+void Node::release() {
+	m_children = std::pmr::vector<Node*>(m_arena);
+	m_bank = nullptr;
+	m_bankIndex = 0;
+}
+
+void Node::bankLeaves(LeafBank& bank) {
+	std::vector<const GLFSR*> leaves;
+	for (Node* child : m_children) {
+		const GLFSR* glfsr = child->getGLFSR();
+		if (glfsr != nullptr) {
+			leaves.push_back(glfsr);
+		}
+	}
+	if (leaves.empty()) {
+		for (Node* child : m_children) {
+			child->bankLeaves(bank);
+		}
+		return;
+	}
+	if (leaves.size() != m_children.size()
+		|| !bank.addGate(getType(), leaves, m_bankIndex)) {
+		return;
+	}
+	m_bank = &bank;
+	for (Node* child : m_children) {
+		child->clear();
+	}
+}
+
+const GLFSR* Node::getGLFSR() const {
+	return nullptr;
+}
+
+const std::pmr::vector<Node*>& Node::getChildren() const {
+	return m_children;
+}
+
+bool Node::isBanked() const {
+	return m_bank != nullptr;
+}
+
+size_t Node::getBankIndex() const {
+	return m_bankIndex;
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+File:		NodeArena.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@14:20
+Purpose:	Implement the NodeArena class functions found in NodeArena.h.
+*/
+
+#include "NodeArena.h"
+
+#include <cstdint>
+#include <cstring>
+
+// Implement NodeArena class functions.
+
+void NodeArena::reset() {
+	for (Block& block : m_blocks) {
+		std::memset(block.memory.get(), 0, block.used);
+		block.used = 0;
+	}
+	m_current = 0;
+}
+
+void NodeArena::release() {
+	reset();
+	m_blocks.clear();
+}
+
+size_t NodeArena::getUsed() const {
+	size_t used = 0;
+	for (const Block& block : m_blocks) {
+		used += block.used;
+	}
+	return used;
+}
+
+size_t NodeArena::getCapacity() const {
+	size_t capacity = 0;
+	for (const Block& block : m_blocks) {
+		capacity += block.size;
+	}
+	return capacity;
+}
+
+void* NodeArena::do_allocate(size_t bytes, size_t alignment) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return allocateLocked(bytes, alignment);
+}
+
+void* NodeArena::allocateLocked(size_t bytes, size_t alignment) {
+	for (; m_current < m_blocks.size(); m_current++) {
+		Block& block = m_blocks[m_current];
+		uintptr_t start = (uintptr_t)block.memory.get();
+		size_t offset = (size_t)(((start + block.used + alignment - 1)
+			& ~(uintptr_t)(alignment - 1)) - start);
+		if (offset + bytes <= block.size) {
+			block.used = offset + bytes;
+			return block.memory.get() + offset;
+		}
+	}
+	size_t size = bytes + alignment > NODE_ARENA_BLOCK_SIZE ? bytes + alignment
+		: NODE_ARENA_BLOCK_SIZE;
+	m_blocks.push_back({ std::make_unique<std::byte[]>(size), size, 0, });
+	m_current = m_blocks.size() - 1;
+	return allocateLocked(bytes, alignment);
+}
+
+void NodeArena::do_deallocate(void*, size_t, size_t) {}
+
+bool NodeArena::do_is_equal(const std::pmr::memory_resource& other) const
+	noexcept {
+	return this == &other;
+}
@@ -6,40 +6,45 @@ Purpose:	Implement the ORNode class functions found in Nodes.h.
 */
 
 #include "Nodes.h"
+#include "LeafBank.h"
 #include "Utilities.h"
 
 // Implement ORNode class functions.
 
-void ORNode::seed(const std::string& seed, unsigned int levelCount) {
-	std::vector<bool> seedHashBinary = SHA512Binary(seed);
+void ORNode::seed(std::string_view seed, unsigned int levelCount,
+	ThreadPool* pool) {
+	SHA512Digest seedHash = SHA512Raw(seed);
 	if (levelCount > 1) {
-		uint8_t XORCount = 1 + (uint8_t)seedHashBinary[508];
+		uint8_t XORCount = 1 + (uint8_t)digestBit(seedHash, 508);
 		for (size_t i = 0; i < XORCount; i++) {
-			m_children.push_back(new XORNode);
+			m_children.push_back(m_arena->create<XORNode>());
 		}
-		uint8_t ANDCount = 1 + (uint8_t)seedHashBinary[509];
+		uint8_t ANDCount = 1 + (uint8_t)digestBit(seedHash, 509);
 		for (size_t i = 0; i < ANDCount; i++) {
-			m_children.push_back(new ANDNode);
+			m_children.push_back(m_arena->create<ANDNode>());
 		}
 	}
 	else {
-		uint8_t glfsrCount = 0x00;
-		for (size_t i = 510; i < 512; i++) {
-			glfsrCount <<= 1;
-			glfsrCount |= (uint8_t)seedHashBinary[i];
-		}
+		uint8_t glfsrCount = digestBits(seedHash, 510, 2);
 		glfsrCount += 2;
 		for (size_t i = 0; i < glfsrCount; i++) {
-			m_children.push_back(new GLFSRNode);
+			m_children.push_back(m_arena->create<GLFSRNode>());
 		}
 	}
-	Node::seed(seed, levelCount);
+	Node::seed(seed, levelCount, pool);
 }
 
 uint8_t ORNode::generate() {
+	if (m_bank != nullptr) {
+		return m_bank->getOutput(NodeType::OR, m_bankIndex);
+	}
 	uint8_t byte = m_children[0]->generate();
 	for (size_t i = 1; i < m_children.size(); i++) {
 		byte |= m_children[i]->generate();
 	}
 	return byte;
+}
+
+NodeType ORNode::getType() const {
+	return NodeType::OR;
 }
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+File:		PackedFormat.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@20:05
+Purpose:	Implement the functions found in PackedFormat.h.
+*/
+
+#include "PackedFormat.h"
+
+#include <bit>
+#include <cerrno>
+#include <cfloat>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
+// Implement PackedFormat module functions.
+
+/*
+Store a value in a buffer, least significant byte first.
+Template: typename T - The unsigned integer type of the value.
+Parameter: uint8_t* output - The buffer to store the value at.
+Parameter: T value - The value to store.
+*/
+template <typename T>
+static void storeLittleEndian(uint8_t* output, T value) {
+	if constexpr (std::endian::native == std::endian::little) {
+		std::memcpy(output, &value, sizeof(T));
+	}
+	else {
+		for (size_t i = 0; i < sizeof(T); i++) {
+			output[i] = (uint8_t)(value >> (8 * i));
+		}
+	}
+}
+
+bool parsePackedRange(PackedFormat& format, const std::string& minimum,
+	const std::string& maximum) {
+	bool integer = format.type == ElementType::INT32
+		|| format.type == ElementType::INT64;
+	if (minimum.empty() && maximum.empty()) {
+		format.integerMinimum = format.type == ElementType::INT32
+			? INT32_MIN : INT64_MIN;
+		format.integerMaximum = format.type == ElementType::INT32
+			? INT32_MAX : INT64_MAX;
+		format.floatMinimum = 0.0;
+		format.floatMaximum = 1.0;
+		return true;
+	}
+	if (minimum.empty() || maximum.empty()) {
+		return false;
+	}
+	char* minimumEnd = nullptr;
+	char* maximumEnd = nullptr;
+	errno = 0;
+	if (integer) {
+		format.integerMinimum = std::strtoll(minimum.c_str(), &minimumEnd, 10);
+		format.integerMaximum = std::strtoll(maximum.c_str(), &maximumEnd, 10);
+	}
+	else {
+		format.floatMinimum = std::strtod(minimum.c_str(), &minimumEnd);
+		format.floatMaximum = std::strtod(maximum.c_str(), &maximumEnd);
+	}
+	// Integers beyond 64 bits saturate and set ERANGE, while floats beyond a
+	// double become infinite and are rejected below.
+	if (*minimumEnd != '\0' || *maximumEnd != '\0'
+		|| (integer && errno == ERANGE)) {
+		return false;
+	}
+	if (format.type == ElementType::INT32) {
+		return format.integerMinimum >= INT32_MIN
+			&& format.integerMaximum <= INT32_MAX
+			&& format.integerMaximum >= format.integerMinimum;
+	}
+	if (integer) {
+		return format.integerMaximum >= format.integerMinimum;
+	}
+	if (!std::isfinite(format.floatMinimum)
+		|| !std::isfinite(format.floatMaximum)) {
+		return false;
+	}
+	if (format.type == ElementType::FLOAT32) {
+		// Bounds which narrow to the same float would leave a single value.
+		return std::fabs(format.floatMinimum) <= FLT_MAX
+			&& std::fabs(format.floatMaximum) <= FLT_MAX
+			&& (float)format.floatMaximum > (float)format.floatMinimum;
+	}
+	return format.floatMaximum > format.floatMinimum;
+}
+
+std::string npyHeader(const PackedFormat& format, uint64_t count) {
+	std::string dictionary = "{'descr': '"
+		+ NPY_DESCRIPTORS[(size_t)format.type]
+		+ "', 'fortran_order': False, 'shape': (" + std::to_string(count)
+		+ ",), }";
+	// The dictionary is padded with spaces and ends with a newline, after the
+	// magic string and its 2-byte length.
+	size_t length = NPY_MAGIC.length() + 2 + dictionary.length() + 1;
+	dictionary.append((NPY_HEADER_ALIGNMENT - length % NPY_HEADER_ALIGNMENT)
+		% NPY_HEADER_ALIGNMENT, ' ');
+	dictionary += '\n';
+	std::string header = NPY_MAGIC;
+	header += (char)(dictionary.length() & 0xFF);
+	header += (char)(dictionary.length() >> 8);
+	return header + dictionary;
+}
+
+void drawPacked(Sampler& sampler, const PackedFormat& format, uint8_t* output,
+	size_t count) {
+	size_t elementSize = ELEMENT_SIZES[(size_t)format.type];
+	for (size_t i = 0; i < count; i++, output += elementSize) {
+		if (format.type == ElementType::INT32) {
+			storeLittleEndian(output, (uint32_t)sampler.nextInRange(
+				format.integerMinimum, format.integerMaximum));
+		}
+		else if (format.type == ElementType::INT64) {
+			storeLittleEndian(output, (uint64_t)sampler.nextInRange(
+				format.integerMinimum, format.integerMaximum));
+		}
+		else if (format.type == ElementType::FLOAT32) {
+			storeLittleEndian(output, std::bit_cast<uint32_t>(
+				sampler.nextFloat((float)format.floatMinimum,
+				(float)format.floatMaximum)));
+		}
+		else {
+			storeLittleEndian(output, std::bit_cast<uint64_t>(
+				sampler.nextDouble(format.floatMinimum,
+				format.floatMaximum)));
+		}
+	}
+}
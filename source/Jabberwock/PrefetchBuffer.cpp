@@ -0,0 +1,133 @@
+/*
+File:		PrefetchBuffer.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@17:40
+Purpose:	Implement the PrefetchBuffer class functions found in
+			PrefetchBuffer.h.
+*/
+
+#include "PrefetchBuffer.h"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstring>
+
+// Implement PrefetchBuffer class functions.
+
+PrefetchBuffer::~PrefetchBuffer() {
+	stop();
+}
+
+bool PrefetchBuffer::start(const Jabberwock& source, size_t capacity) {
+	stop();
+	if (!source.clone(m_generator)) {
+		return false;
+	}
+	m_ring.assign(std::bit_ceil(std::max(capacity, (size_t)2)), 0);
+	m_mask = m_ring.size() - 1;
+	m_origin = m_generator.getPosition();
+	m_written = 0;
+	m_claimed = 0;
+	m_released = 0;
+	m_underruns = 0;
+	m_producerNanoseconds = 0;
+	m_producer = std::thread(&PrefetchBuffer::produce, this);
+	return true;
+}
+
+uint64_t PrefetchBuffer::read(uint8_t* output, size_t length) {
+	uint64_t first = m_claimed.load(std::memory_order_relaxed);
+	while (!m_claimed.compare_exchange_weak(first, first + length,
+		std::memory_order_relaxed)) {}
+	// The claim is copied out in pieces of at most half the ring, each
+	// released as soon as it is copied so that the producer can refill it
+	// while the rest of a long claim is still to come.
+	size_t pieceLength = m_ring.size() / 2;
+	bool waited = false;
+	for (size_t offset = 0; offset < length; offset += pieceLength) {
+		uint64_t start = first + offset;
+		uint64_t end = start + std::min(pieceLength, length - offset);
+		uint64_t written = m_written.load(std::memory_order_acquire);
+		while (written < end) {
+			waited = true;
+			m_written.wait(written, std::memory_order_acquire);
+			written = m_written.load(std::memory_order_acquire);
+		}
+		size_t ringStart = (size_t)(start & m_mask);
+		size_t copyLength = (size_t)(end - start);
+		size_t headLength = std::min(m_ring.size() - ringStart, copyLength);
+		std::memcpy(output + offset, m_ring.data() + ringStart, headLength);
+		std::memcpy(output + offset + headLength, m_ring.data(),
+			copyLength - headLength);
+		// Space is released in claim order, so that the producer only
+		// refills bytes which every earlier claim has finished copying.
+		uint64_t released = m_released.load(std::memory_order_acquire);
+		while (released != start) {
+			m_released.wait(released, std::memory_order_acquire);
+			released = m_released.load(std::memory_order_acquire);
+		}
+		m_released.store(end, std::memory_order_release);
+		m_released.notify_all();
+		m_producerSignal.fetch_add(1, std::memory_order_release);
+		m_producerSignal.notify_one();
+	}
+	if (waited) {
+		m_underruns.fetch_add(1, std::memory_order_relaxed);
+	}
+	return m_origin + first;
+}
+
+void PrefetchBuffer::stop() {
+	if (!m_producer.joinable()) {
+		return;
+	}
+	m_stopping = true;
+	m_producerSignal.fetch_add(1);
+	m_producerSignal.notify_one();
+	m_producer.join();
+	m_stopping = false;
+	m_generator.clear();
+}
+
+PrefetchBuffer::Counters PrefetchBuffer::getCounters() const {
+	uint64_t written = m_written.load();
+	uint64_t claimed = m_claimed.load();
+	uint64_t producedNanoseconds = m_producerNanoseconds.load();
+	Counters counters;
+	counters.fillLevel = written > claimed ? written - claimed : 0;
+	counters.underruns = m_underruns.load();
+	counters.producedBytes = written;
+	counters.producerThroughput = producedNanoseconds == 0 ? 0.0
+		: written * 1e9 / producedNanoseconds;
+	return counters;
+}
+
+void PrefetchBuffer::produce() {
+	uint64_t refillLength = std::min((uint64_t)PREFETCH_REFILL_LENGTH,
+		(uint64_t)m_ring.size() / 2);
+	uint64_t written = m_written.load(std::memory_order_relaxed);
+	while (!m_stopping.load(std::memory_order_acquire)) {
+		uint32_t signal = m_producerSignal.load(std::memory_order_acquire);
+		uint64_t free = m_ring.size() - (written
+			- m_released.load(std::memory_order_acquire));
+		if (free < refillLength) {
+			m_producerSignal.wait(signal, std::memory_order_acquire);
+			continue;
+		}
+		// Generate up to the end of the ring, wrapping on the next pass.
+		uint64_t start = written & m_mask;
+		size_t length = (size_t)std::min({ free,
+			(uint64_t)PREFETCH_REFILL_LENGTH,
+			(uint64_t)(m_ring.size() - start), });
+		std::chrono::steady_clock::time_point begin
+			= std::chrono::steady_clock::now();
+		m_generator.generate(m_ring.data() + start, length);
+		m_producerNanoseconds.fetch_add((uint64_t)std::chrono::duration_cast<
+			std::chrono::nanoseconds>(std::chrono::steady_clock::now()
+			- begin).count(), std::memory_order_relaxed);
+		written += length;
+		m_written.store(written, std::memory_order_release);
+		m_written.notify_all();
+	}
+}
@@ -0,0 +1,127 @@
+/*
+File:		Sampler.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@19:45
+Purpose:	Implement the Sampler class functions found in Sampler.h.
+*/
+
+#include "Sampler.h"
+
+#include <bit>
+#include <cmath>
+
+// Implement Sampler module functions.
+
+// The number of bytes drawn for the fraction of a float, which has 24 bits.
+const static size_t FLOAT_FRACTION_LENGTH = 3;
+// The number of bytes drawn for the fraction of a double, which has 53 bits
+// of the 56 drawn.
+const static size_t DOUBLE_FRACTION_LENGTH = 7;
+
+/*
+Multiply two 64-bit integers into a 128-bit product.
+Parameter: uint64_t a - The first factor.
+Parameter: uint64_t b - The second factor.
+Parameter: uint64_t& high - Set to the high 64 bits of the product.
+Returns: uint64_t - The low 64 bits of the product.
+*/
+static uint64_t multiplyWide(uint64_t a, uint64_t b, uint64_t& high) {
+	uint64_t aLow = a & 0xFFFFFFFF;
+	uint64_t aHigh = a >> 32;
+	uint64_t bLow = b & 0xFFFFFFFF;
+	uint64_t bHigh = b >> 32;
+	uint64_t lowLow = aLow * bLow;
+	uint64_t highLow = aHigh * bLow;
+	uint64_t lowHigh = aLow * bHigh;
+	uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF)
+		+ (lowHigh & 0xFFFFFFFF);
+	high = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+	return (middle << 32) | (lowLow & 0xFFFFFFFF);
+}
+
+// Implement Sampler class functions.
+
+Sampler::Sampler(Jabberwock* jabberwock) : m_jabberwock(jabberwock),
+	m_buffer(SAMPLER_BUFFER_LENGTH), m_offset(SAMPLER_BUFFER_LENGTH) {}
+
+uint64_t Sampler::nextBelow(uint64_t bound) {
+	if (bound <= 1) {
+		return 0;
+	}
+	// Draw the fewest whole bytes which can hold every value below the bound.
+	size_t length = ((size_t)std::bit_width(bound - 1) + 7) / 8;
+	size_t bits = length * 8;
+	uint64_t mask = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+	// The product of a draw and the bound spans the bound's multiples of
+	// 2^bits; its high part is the value and its low part is rejected while
+	// it falls in the 2^bits mod bound values which would favour the
+	// smallest results.
+	uint64_t high = 0;
+	uint64_t low = multiplyWide(consume(length), bound, high);
+	uint64_t fraction = low & mask;
+	if (fraction < bound) {
+		uint64_t threshold = bits == 64 ? (0 - bound) % bound
+			: (mask + 1) % bound;
+		while (fraction < threshold) {
+			low = multiplyWide(consume(length), bound, high);
+			fraction = low & mask;
+		}
+	}
+	return bits == 64 ? high : (high << (64 - bits)) | (low >> bits);
+}
+
+int64_t Sampler::nextInRange(int64_t minimum, int64_t maximum) {
+	uint64_t span = (uint64_t)maximum - (uint64_t)minimum;
+	uint64_t offset = span == ~0ULL ? consume(8) : nextBelow(span + 1);
+	return (int64_t)((uint64_t)minimum + offset);
+}
+
+size_t Sampler::nextIndex(size_t count) {
+	if (count > 256) {
+		return (size_t)nextBelow(count);
+	}
+	// Bytes from the largest multiple of the count up to 256 would favour the
+	// first characters, so they are redrawn.
+	size_t limit = 256 - 256 % count;
+	size_t byte = (size_t)consume(1);
+	while (byte >= limit) {
+		byte = (size_t)consume(1);
+	}
+	return byte % count;
+}
+
+float Sampler::nextFloat(float minimum, float maximum) {
+	float fraction = (float)consume(FLOAT_FRACTION_LENGTH) * 0x1.0p-24f;
+	// The range is halved so that its width fits even when it spans more
+	// than the largest float; halving and doubling are exact, so narrower
+	// ranges draw the same values as without them.
+	float value = (minimum * 0.5f + (maximum * 0.5f - minimum * 0.5f)
+		* fraction) * 2.0f;
+	// Rounding may carry the largest fractions up to the bound.
+	return value < maximum ? value : std::nextafter(maximum, minimum);
+}
+
+double Sampler::nextDouble(double minimum, double maximum) {
+	double fraction = (double)(consume(DOUBLE_FRACTION_LENGTH) >> 3)
+		* 0x1.0p-53;
+	double value = (minimum * 0.5 + (maximum * 0.5 - minimum * 0.5)
+		* fraction) * 2.0;
+	return value < maximum ? value : std::nextafter(maximum, minimum);
+}
+
+uint64_t Sampler::getConsumedBytes() const {
+	return m_consumedBytes;
+}
+
+uint64_t Sampler::consume(size_t count) {
+	uint64_t value = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (m_offset == m_buffer.size()) {
+			m_jabberwock->generate(m_buffer.data(), m_buffer.size());
+			m_offset = 0;
+		}
+		value = (value << 8) | m_buffer[m_offset++];
+	}
+	m_consumedBytes += count;
+	return value;
+}
@@ -0,0 +1,92 @@
+/*
+File:		ThreadPool.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@15:10
+Purpose:	Implement the ThreadPool class functions found in ThreadPool.h.
+*/
+
+#include "ThreadPool.h"
+
+// Implement ThreadPool class functions.
+
+ThreadPool::~ThreadPool() {
+	stop();
+}
+
+void ThreadPool::start(size_t workerCount) {
+	if (workerCount == m_workers.size()) {
+		return;
+	}
+	stop();
+	for (size_t i = 0; i < workerCount; i++) {
+		m_workers.emplace_back(&ThreadPool::work, this, m_batch);
+	}
+}
+
+void ThreadPool::run(size_t taskCount,
+	const std::function<void(size_t)>& task) {
+	if (m_workers.empty() || taskCount <= 1) {
+		for (size_t i = 0; i < taskCount; i++) {
+			task(i);
+		}
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_task = &task;
+		m_taskCount = taskCount;
+		m_nextTask = 0;
+		m_busyWorkers = m_workers.size();
+		m_batch++;
+	}
+	m_wake.notify_all();
+	runTasks();
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_busyWorkers == 0; });
+	m_task = nullptr;
+	m_taskCount = 0;
+}
+
+void ThreadPool::stop() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_wake.notify_all();
+	for (std::thread& worker : m_workers) {
+		worker.join();
+	}
+	m_workers.clear();
+	m_stopping = false;
+}
+
+size_t ThreadPool::getWorkerCount() const {
+	return m_workers.size();
+}
+
+void ThreadPool::work(uint64_t batch) {
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [this, batch]() {
+				return m_stopping || m_batch != batch;
+			});
+			if (m_stopping) {
+				return;
+			}
+			batch = m_batch;
+		}
+		runTasks();
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_busyWorkers--;
+		if (m_busyWorkers == 0) {
+			m_done.notify_one();
+		}
+	}
+}
+
+void ThreadPool::runTasks() {
+	for (size_t i = m_nextTask++; i < m_taskCount; i = m_nextTask++) {
+		(*m_task)(i);
+	}
+}
@@ -0,0 +1,214 @@
+/*
+File:		TreeProgram.cpp
+Author:		Keegan MacDonald
+Created:	2026.10.17@13:05
+Purpose:	Implement the TreeProgram class functions found in TreeProgram.h.
+*/
+
+#include "TreeProgram.h"
+#include "Snapshot.h"
+
+#include <cstring>
+
+// Implement TreeProgram class functions.
+
+bool TreeProgram::compile(const Node& root, const LeafBank& bank) {
+	clear();
+	std::vector<const Node*> order = { &root };
+	for (size_t i = 0; i < order.size(); i++) {
+		if (order[i]->isBanked()) {
+			continue;
+		}
+		const std::pmr::vector<Node*>& children = order[i]->getChildren();
+		if (children.empty()) {
+			return false;
+		}
+		for (const Node* child : children) {
+			if (child->getType() == NodeType::GLFSR) {
+				return false;
+			}
+			order.push_back(child);
+		}
+	}
+	// Reversing the breadth-first order puts children before their parents
+	// and keeps each gate's children consecutive.
+	size_t count = order.size();
+	m_instructions.resize(count);
+	size_t nextChild = 1;
+	for (size_t i = 0; i < count; i++) {
+		const Node* node = order[i];
+		Instruction& instruction = m_instructions[count - 1 - i];
+		if (node->isBanked()) {
+			instruction.op = TreeOperation::LOAD;
+			instruction.first = (uint32_t)bank.getOutputIndex(node->getType(),
+				node->getBankIndex());
+			instruction.count = 0;
+			continue;
+		}
+		switch (node->getType()) {
+		case NodeType::XOR:
+			instruction.op = TreeOperation::XOR;
+			break;
+		case NodeType::AND:
+			instruction.op = TreeOperation::AND;
+			break;
+		default:
+			instruction.op = TreeOperation::OR;
+			break;
+		}
+		size_t childCount = node->getChildren().size();
+		instruction.first = (uint32_t)(count - nextChild - childCount);
+		instruction.count = (uint32_t)childCount;
+		nextChild += childCount;
+	}
+	m_results.assign(count, 0);
+	return true;
+}
+
+uint8_t TreeProgram::run(const uint64_t* outputs) {
+	const Instruction* instructions = m_instructions.data();
+	uint8_t* results = m_results.data();
+	size_t count = m_instructions.size();
+	for (size_t i = 0; i < count; i++) {
+		const Instruction& instruction = instructions[i];
+		if (instruction.op == TreeOperation::LOAD) {
+			results[i] = (uint8_t)outputs[instruction.first];
+			continue;
+		}
+		// The gate operations are in NodeType order after LOAD.
+		JABBERWOCK_PROFILE_SCOPE(m_nanoseconds[(size_t)instruction.op - 1]);
+		const uint8_t* operands = results + instruction.first;
+		uint8_t byte = operands[0];
+		switch (instruction.op) {
+		case TreeOperation::XOR:
+			for (uint32_t j = 1; j < instruction.count; j++) {
+				byte ^= operands[j];
+			}
+			break;
+		case TreeOperation::AND:
+			for (uint32_t j = 1; j < instruction.count; j++) {
+				byte &= operands[j];
+			}
+			break;
+		default:
+			for (uint32_t j = 1; j < instruction.count; j++) {
+				byte |= operands[j];
+			}
+			break;
+		}
+		results[i] = byte;
+	}
+	return results[count - 1];
+}
+
+void TreeProgram::runBlock(const uint8_t* outputs, uint8_t* block,
+	size_t length) {
+	size_t count = m_instructions.size();
+	m_blockResults.resize(count * length);
+	uint8_t* results = m_blockResults.data();
+	for (size_t i = 0; i < count; i++) {
+		const Instruction& instruction = m_instructions[i];
+		uint8_t* result = results + i * length;
+		if (instruction.op == TreeOperation::LOAD) {
+			std::memcpy(result, outputs + instruction.first * length, length);
+			continue;
+		}
+		JABBERWOCK_PROFILE_SCOPE(m_nanoseconds[(size_t)instruction.op - 1]);
+		const uint8_t* operands = results + instruction.first * length;
+		std::memcpy(result, operands, length);
+		for (uint32_t j = 1; j < instruction.count; j++) {
+			const uint8_t* operand = operands + j * length;
+			switch (instruction.op) {
+			case TreeOperation::XOR:
+				for (size_t t = 0; t < length; t++) {
+					result[t] ^= operand[t];
+				}
+				break;
+			case TreeOperation::AND:
+				for (size_t t = 0; t < length; t++) {
+					result[t] &= operand[t];
+				}
+				break;
+			default:
+				for (size_t t = 0; t < length; t++) {
+					result[t] |= operand[t];
+				}
+				break;
+			}
+		}
+	}
+	std::memcpy(block, results + (count - 1) * length, length);
+}
+
+bool TreeProgram::isCompiled() const {
+	return !m_instructions.empty();
+}
+
+const std::vector<TreeProgram::Instruction>& TreeProgram::getInstructions()
+	const {
+	return m_instructions;
+}
+
+size_t TreeProgram::getHeapBytes() const {
+	return m_instructions.capacity() * sizeof(Instruction)
+		+ m_results.capacity() + m_blockResults.capacity();
+}
+
+uint64_t TreeProgram::getNanoseconds(NodeType type) const {
+	return type == NodeType::GLFSR ? 0 : m_nanoseconds[(size_t)type];
+}
+
+void TreeProgram::resetProfile() {
+	for (size_t i = 0; i < 3; i++) {
+		m_nanoseconds[i] = 0;
+	}
+}
+
+void TreeProgram::save(std::ostream& output) const {
+	writeSnapshotValue(output, (uint64_t)m_instructions.size());
+	for (const Instruction& instruction : m_instructions) {
+		writeSnapshotValue(output, (uint8_t)instruction.op);
+		writeSnapshotValue(output, instruction.first);
+		writeSnapshotValue(output, instruction.count);
+	}
+}
+
+bool TreeProgram::load(std::istream& input, const LeafBank& bank) {
+	clear();
+	uint64_t count = 0;
+	if (!readSnapshotValue(input, count) || count == 0
+		|| count > JABBERWOCK_SNAPSHOT_MAXIMUM_COUNT) {
+		return false;
+	}
+	m_instructions.resize((size_t)count);
+	for (size_t i = 0; i < m_instructions.size(); i++) {
+		Instruction& instruction = m_instructions[i];
+		uint8_t op = 0;
+		if (!readSnapshotValue(input, op)
+			|| !readSnapshotValue(input, instruction.first)
+			|| !readSnapshotValue(input, instruction.count)
+			|| op > (uint8_t)TreeOperation::OR) {
+			clear();
+			return false;
+		}
+		instruction.op = (TreeOperation)op;
+		// Operands must be earlier results, or outputs of the leaf bank.
+		bool valid = instruction.op == TreeOperation::LOAD
+			? instruction.first < bank.getOutputCount()
+			: instruction.count > 0
+			&& (uint64_t)instruction.first + instruction.count <= i;
+		if (!valid) {
+			clear();
+			return false;
+		}
+	}
+	m_results.assign(m_instructions.size(), 0);
+	return true;
+}
+
+void TreeProgram::clear() {
+	m_instructions.clear();
+	m_results.clear();
+	m_blockResults.clear();
+	resetProfile();
+}
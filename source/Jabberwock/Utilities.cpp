@@ -6,73 +6,145 @@ Purpose:	Implement functions found in Utilities.h.
 */
 
 #include "Utilities.h"
+#include "Hash.h"
 
 #include <SHA/SHA512.h>
 
+#include <algorithm>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__x86_64__)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#define JABBERWOCK_X64
+#endif
+
 // Implement Utilities module functions.
 
+// The number of 4-character chunks whose hashes are computed together while
+// permuting a string.
+const static size_t PERMUTE_HASH_BATCH = 16;
+
 std::string SHA512String(const std::string& input) {
 	SHA512 sha;
 	return sha.hash(input);
 }
 
 std::vector<bool> SHA512Binary(const std::string& input) {
-	std::string hashString = SHA512String(input);
-	std::vector<bool> hashBinary;
-	for (size_t i = 0; i < hashString.length(); i++) {
-		char c = hashString[i];
-		uint8_t bits = 0x00;
-		for (size_t j = 0; j < 16; j++) {
-			if (HEX_CHARACTERS[j] == c) {
-				bits = (uint8_t)j;
-				break;
-			}
-		}
-		for (size_t j = 0; j < 4; j++) {
-			hashBinary.push_back((bool)((bits >> (4 - j - 1)) & 0x01));
-		}
+	SHA512Digest digest = SHA512Raw(input);
+	std::vector<bool> hashBinary(SHA512_DIGEST_LENGTH * 8);
+	for (size_t i = 0; i < hashBinary.size(); i++) {
+		hashBinary[i] = digestBit(digest, i);
 	}
 	return hashBinary;
 }
 
-std::string permuteString(const std::string& input) {
-	std::string permutation = input;
-	std::string seedHashString = SHA512String(input);
-	size_t paddingIndex = 0;
-	do {
-		permutation += seedHashString[paddingIndex];
-		paddingIndex++;
-	} while (permutation.length() % 8 != 0);
-	std::vector<std::string> chunks4;
-	for (size_t i = 0; i < permutation.length(); i += 4) {
-		chunks4.push_back(permutation.substr(i, 4));
+size_t permutedLength(size_t length) {
+	return length - length % 8 + 8;
+}
+
+size_t permuteString(const char* input, size_t length, char* output) {
+	SHA512Digest inputHash = SHA512Raw((const uint8_t*)input, length);
+	if (output != input) {
+		std::memmove(output, input, length);
 	}
-	permutation.clear();
-	for (size_t i = 0; i < chunks4.size(); i++) {
-		std::vector<bool> chunk4HashBinary = SHA512Binary(chunks4[i]);
-		uint8_t permutation4Index = 0x00;
-		for (size_t j = 508; j < 512; j++) {
-			permutation4Index <<= 1;
-			permutation4Index |= (uint8_t)chunk4HashBinary[j];
+	size_t permutationLength = permutedLength(length);
+	for (size_t i = length; i < permutationLength; i++) {
+		output[i] = HEX_CHARACTERS[digestBits(inputHash, (i - length) * 4, 4)];
+	}
+	// Each 4-character chunk is permuted by its own hash alone, so the hashes
+	// of a batch of chunks are computed together in SIMD lanes first.
+	SHA512Digest chunkHashes[PERMUTE_HASH_BATCH];
+	size_t chunk4Count = permutationLength / 4;
+	for (size_t first = 0; first < chunk4Count; first += PERMUTE_HASH_BATCH) {
+		size_t batch = std::min(PERMUTE_HASH_BATCH, chunk4Count - first);
+		SHA512RawMany((const uint8_t*)output + first * 4, 4, batch,
+			chunkHashes);
+		for (size_t k = 0; k < batch; k++) {
+			uint8_t permutation4Index = digestBits(chunkHashes[k], 508, 4);
+			char* chunk = output + (first + k) * 4;
+			char chunk4[4];
+			std::memcpy(chunk4, chunk, 4);
+			for (size_t j = 0; j < 4; j++) {
+				chunk[j] = chunk4[PERMUTATIONS_4[permutation4Index][j] - 1];
+			}
 		}
-		for (size_t j = 0; j < 4; j++) {
-			permutation += chunks4[i][PERMUTATIONS_4[permutation4Index][j] - 1];
+	}
+	uint8_t permutation8Index = digestBits(SHA512Raw((const uint8_t*)output,
+		permutationLength), 508, 4);
+	const std::vector<size_t>& order = PERMUTATIONS_8[permutation8Index];
+	// Chunk order[i] - 1 moves to chunk i. The chunks are moved in place one
+	// character offset at a time, following the cycles of the permutation.
+	size_t chunk8Length = permutationLength / 8;
+	for (size_t offset = 0; offset < chunk8Length; offset++) {
+		bool moved[8] = { false, false, false, false, false, false, false,
+			false, };
+		for (size_t start = 0; start < 8; start++) {
+			if (moved[start]) {
+				continue;
+			}
+			char first = output[start * chunk8Length + offset];
+			size_t i = start;
+			while (true) {
+				size_t source = order[i] - 1;
+				moved[i] = true;
+				if (source == start) {
+					output[i * chunk8Length + offset] = first;
+					break;
+				}
+				output[i * chunk8Length + offset]
+					= output[source * chunk8Length + offset];
+				i = source;
+			}
 		}
 	}
-	std::vector<std::string> chunks8(8);
-	size_t chunk8Length = permutation.length() / 8;
-	for (size_t i = 0; i < 8; i++) {
-		chunks8[i] = permutation.substr(i * chunk8Length, chunk8Length);
+	return permutationLength;
+}
+
+std::string permuteString(const std::string& input) {
+	std::string permutation(permutedLength(input.length()), '\0');
+	permuteString(input.data(), input.length(), permutation.data());
+	return permutation;
+}
+
+InstructionSet detectInstructionSet() {
+#if defined(JABBERWOCK_X64)
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] < 7) {
+		return InstructionSet::SSE2;
 	}
-	std::vector<bool> permutationHashBinary = SHA512Binary(permutation);
-	uint8_t permutation8Index = 0x00;
-	for (size_t i = 508; i < 512; i++) {
-		permutation8Index <<= 1;
-		permutation8Index |= (uint8_t)permutationHashBinary[i];
+	__cpuid(info, 1);
+	bool osxsave = (info[2] >> 27) & 0x01;
+	bool avx = (info[2] >> 28) & 0x01;
+	if (!osxsave || !avx || (_xgetbv(0) & 0x06) != 0x06) {
+		return InstructionSet::SSE2;
 	}
-	permutation.clear();
-	for (size_t i = 0; i < 8; i++) {
-		permutation += chunks8[PERMUTATIONS_8[permutation8Index][i] - 1];
+	__cpuidex(info, 7, 0);
+	if ((info[1] >> 5) & 0x01) {
+		return InstructionSet::AVX2;
 	}
-	return permutation;
-}
\ No newline at end of file
+	return InstructionSet::SSE2;
+#else
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		return InstructionSet::AVX2;
+	}
+	return InstructionSet::SSE2;
+#endif
+#else
+	return InstructionSet::SCALAR;
+#endif
+}
+
+// Implement ProfileTimer class functions.
+
+ProfileTimer::ProfileTimer(uint64_t& counter) : m_counter(counter),
+	m_start(std::chrono::steady_clock::now()) {}
+
+ProfileTimer::~ProfileTimer() {
+	m_counter += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - m_start).count();
+}
@@ -6,44 +6,49 @@ Purpose:	Implement the XORNode class functions found in Nodes.h.
 */
 
 #include "Nodes.h"
+#include "LeafBank.h"
 #include "Utilities.h"
 
 // Implement XORNode class functions.
 
-void XORNode::seed(const std::string& seed, unsigned int levelCount) {
-	std::vector<bool> seedHashBinary = SHA512Binary(seed);
+void XORNode::seed(std::string_view seed, unsigned int levelCount,
+	ThreadPool* pool) {
+	SHA512Digest seedHash = SHA512Raw(seed);
 	if (levelCount > 1) {
-		uint8_t XORCount = 2 + (uint8_t)seedHashBinary[508];
+		uint8_t XORCount = 2 + (uint8_t)digestBit(seedHash, 508);
 		for (size_t i = 0; i < XORCount; i++) {
-			m_children.push_back(new XORNode);
+			m_children.push_back(m_arena->create<XORNode>());
 		}
-		uint8_t ANDCount = 1 + (uint8_t)seedHashBinary[509];
+		uint8_t ANDCount = 1 + (uint8_t)digestBit(seedHash, 509);
 		for (size_t i = 0; i < ANDCount; i++) {
-			m_children.push_back(new ANDNode);
+			m_children.push_back(m_arena->create<ANDNode>());
 		}
-		uint8_t ORCount = 1 + (uint8_t)seedHashBinary[510];
+		uint8_t ORCount = 1 + (uint8_t)digestBit(seedHash, 510);
 		for (size_t i = 0; i < ORCount; i++) {
-			m_children.push_back(new ORNode);
+			m_children.push_back(m_arena->create<ORNode>());
 		}
 	}
 	else {
-		uint8_t glfsrCount = 0x00;
-		for (size_t i = 510; i < 512; i++) {
-			glfsrCount <<= 1;
-			glfsrCount |= (uint8_t)seedHashBinary[i];
-		}
+		uint8_t glfsrCount = digestBits(seedHash, 510, 2);
 		glfsrCount += 5;
 		for (size_t i = 0; i < glfsrCount; i++) {
-			m_children.push_back(new GLFSRNode);
+			m_children.push_back(m_arena->create<GLFSRNode>());
 		}
 	}
-	Node::seed(seed, levelCount);
+	Node::seed(seed, levelCount, pool);
 }
 
 uint8_t XORNode::generate() {
+	if (m_bank != nullptr) {
+		return m_bank->getOutput(NodeType::XOR, m_bankIndex);
+	}
 	uint8_t byte = m_children[0]->generate();
 	for (size_t i = 1; i < m_children.size(); i++) {
 		byte ^= m_children[i]->generate();
 	}
 	return byte;
+}
+
+NodeType XORNode::getType() const {
+	return NodeType::XOR;
 }
\ No newline at end of file
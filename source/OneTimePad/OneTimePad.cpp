@@ -6,8 +6,10 @@ Purpose:	Implement the main entry point to the OneTimePad program for the
 			Jabberwock PRNG.
 */
 
+#include <Jabberwock/AsyncWriter.h>
 #include <Jabberwock/Jabberwock.h>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 
@@ -16,8 +18,8 @@ Purpose:	Implement the main entry point to the OneTimePad program for the
 // The set of standard printable characters.
 const static std::string CHARACTERS = "abcdefghijklmnopqrstuvwxyz`1234567890-=["
 	"]\\;',./ABCDEFGHIJKLMNOPQRSTUVWXYZ~!@#$%^&*()_+{}|:\"<>?";
-// The set of hex characters.
-const static std::string HEX_CHARACTERS = "0123456789ABCDEF";
+// The number of bytes to process at once.
+const static size_t BUFFER_LENGTH = 1 << 16;
 
 /*
 The main entry point to the OneTimePad program.
@@ -89,9 +91,8 @@ int main(int argc, char** argv) {
 		jabberwock.clear();
 		return EXIT_FAILURE;
 	}
-	std::ofstream outputFile;
-	outputFile.open(outputFileName, std::ios::binary);
-	if (!outputFile.good()) {
+	AsyncWriter outputFile;
+	if (!outputFile.open(outputFileName, BUFFER_LENGTH, SyncPolicy::ON_CLOSE)) {
 		std::cout << "Invalid output file" << std::endl;
 		jabberwock.clear();
 		return EXIT_FAILURE;
@@ -101,24 +102,37 @@ int main(int argc, char** argv) {
 	for (size_t i = 0; i < 10; i++) {
 		progress[i] = false;
 	}
-	for (size_t i = 0; i < inputFileSize; i++) {
-		uint8_t inputByte = 0x00;
-		inputFile.read((char*)(&inputByte), 1);
-		uint8_t outputByte = inputByte ^ jabberwock.generate();
-		inputByte = 0x00;
-		outputFile.write((const char*)(&outputByte), 1);
-		outputByte = 0x00;
+	std::vector<uint8_t> pad(BUFFER_LENGTH);
+	bool success = true;
+	for (size_t i = 0; i < inputFileSize && success; i += BUFFER_LENGTH) {
+		size_t length = std::min(BUFFER_LENGTH, inputFileSize - i);
+		// Each block is encrypted in the writer's free buffer while the last
+		// is written to the output file.
+		uint8_t* buffer = outputFile.getBuffer();
+		inputFile.read((char*)buffer, length);
+		jabberwock.generate(pad.data(), length);
+		for (size_t j = 0; j < length; j++) {
+			buffer[j] ^= pad[j];
+		}
+		success = outputFile.submit(length);
+		size_t last = i + length - 1;
 		for (size_t j = 0; j < 10; j++) {
-			if ((float)i / (float)inputFileSize > (float)j / 10.0f
+			if ((float)last / (float)inputFileSize > (float)j / 10.0f
 				&& !progress[j]) {
 				progress[j] = true;
 				std::cout << (j * 10.0f) << "%, ";
 			}
 		}
 	}
-	std::cout << "Finished" << std::endl;
+	std::fill(pad.begin(), pad.end(), 0x00);
 	inputFile.close();
-	outputFile.close();
+	success &= outputFile.close();
+	if (!success) {
+		std::cout << "Writing the output file failed" << std::endl;
+		jabberwock.clear();
+		return EXIT_FAILURE;
+	}
+	std::cout << "Finished" << std::endl;
 	jabberwock.clear();
 	std::cout << std::endl << "Cleared Jabberwock PRNG" << std::endl;
 	return EXIT_SUCCESS;